@@ -19,6 +19,8 @@
   2 - build Abc serial and inherit code
   3 - build Abc cilk parallel but no inherit code
   4 - build Abc cilk parallel and inherit code
+  5 - build Abc pthread parallel but no inherit code
+  6 - build Abc pthread parallel and inherit code
  */
 #ifdef CLP_HAS_ABC
 #if CLP_HAS_ABC==1
@@ -55,8 +57,25 @@
 #ifndef ABC_INHERIT
 #define ABC_INHERIT
 #endif
+#elif CLP_HAS_ABC==5
+#ifndef ABC_PARALLEL
+#define ABC_PARALLEL 1
+#endif
+#ifndef ABC_USE_HOMEGROWN_LAPACK
+#define ABC_USE_HOMEGROWN_LAPACK 2
+#endif
+#elif CLP_HAS_ABC==6
+#ifndef ABC_PARALLEL
+#define ABC_PARALLEL 1
+#endif
+#ifndef ABC_USE_HOMEGROWN_LAPACK
+#define ABC_USE_HOMEGROWN_LAPACK 2
+#endif
+#ifndef ABC_INHERIT
+#define ABC_INHERIT
+#endif
 #else
-#error "Valid values for CLP_HAS_ABC are 0-4"
+#error "Valid values for CLP_HAS_ABC are 0-6"
 #endif
 #endif
 #endif
@@ -4214,6 +4214,7 @@ AbcSimplex::readLp(const char *filename, const double epsilon )
   translate(DO_SCALE_AND_MATRIX|DO_BASIS_AND_ORDER|DO_STATUS|DO_SOLUTION);
   unsigned int maxLength = 0;
   int iRow;
+  deleteNameHash();
   rowNames_ = std::vector<std::string> ();
   columnNames_ = std::vector<std::string> ();
   rowNames_.reserve(numberRows_);
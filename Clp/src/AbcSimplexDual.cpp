@@ -6051,7 +6051,7 @@ AbcSimplexDual::dual()
     }
   }
 #endif
-#if ABC_PARALLEL==2
+#if ABC_PARALLEL
   abcFactorization_->setParallelMode(parallelMode_);
 #endif
   static_cast<AbcSimplexDual *>(this)->bounceTolerances(-1);
@@ -265,7 +265,7 @@ public:
   inline void setStatus (  int value) {
     coinAbcFactorization_->setStatus(value) ;
   }
-#if ABC_PARALLEL==2
+#if ABC_PARALLEL
   /// Says parallel
   inline void setParallelMode(int value)
   {coinAbcFactorization_->setParallelMode(value);};
@@ -2412,7 +2412,7 @@ CoinAbcDlaswp(int n, double * COIN_RESTRICT a,int lda,int start,int end, int * i
 }
 extern void CoinAbcDgemm(int m, int n, int k, double * COIN_RESTRICT a,int lda,
 			  double * COIN_RESTRICT b,double * COIN_RESTRICT c
-#if ABC_PARALLEL==2
+#if ABC_PARALLEL
 			  ,int parallelMode
 #endif
 			 );
@@ -2514,7 +2514,7 @@ static int CoinAbcDgetrf2(int m, int n, double * COIN_RESTRICT a, int * ipiv)
 
 int 
 CoinAbcDgetrf(int m, int n, double * COIN_RESTRICT a, int lda, int * ipiv
-#if ABC_PARALLEL==2
+#if ABC_PARALLEL
 			  ,int parallelMode
 #endif
 )
@@ -2543,7 +2543,7 @@ CoinAbcDgetrf(int m, int n, double * COIN_RESTRICT a, int lda, int * ipiv
           CoinAbcDgemm(n-end,n-end,newSize,
 			a+start*lda+end*BLOCKING8,lda,
 			a+end*lda+start*BLOCKING8,a+end*lda+end*BLOCKING8
-#if ABC_PARALLEL==2
+#if ABC_PARALLEL
 			  ,parallelMode
 #endif
 			);
@@ -3099,7 +3099,7 @@ CoinAbcDlaswp(int n, long double * COIN_RESTRICT a,int lda,int start,int end, in
 }
 extern void CoinAbcDgemm(int m, int n, int k, long double * COIN_RESTRICT a,int lda,
 			  long double * COIN_RESTRICT b,long double * COIN_RESTRICT c
-#if ABC_PARALLEL==2
+#if ABC_PARALLEL
 			  ,int parallelMode
 #endif
 			 );
@@ -3201,7 +3201,7 @@ static int CoinAbcDgetrf2(int m, int n, long double * COIN_RESTRICT a, int * ipi
 
 int 
 CoinAbcDgetrf(int m, int n, long double * COIN_RESTRICT a, int lda, int * ipiv
-#if ABC_PARALLEL==2
+#if ABC_PARALLEL
 			  ,int parallelMode
 #endif
 )
@@ -3230,7 +3230,7 @@ CoinAbcDgetrf(int m, int n, long double * COIN_RESTRICT a, int lda, int * ipiv
           CoinAbcDgemm(n-end,n-end,newSize,
 			a+start*lda+end*BLOCKING8,lda,
 			a+end*lda+start*BLOCKING8,a+end*lda+end*BLOCKING8
-#if ABC_PARALLEL==2
+#if ABC_PARALLEL
 			  ,parallelMode
 #endif
 			);
@@ -598,6 +598,9 @@ CbcOrClpParam::setDoubleParameterWithMessage ( ClpSimplex * model, double value
           case CLP_PARAM_DBL_PRESOLVETOLERANCE:
                model->setDblParam(ClpPresolveTolerance, value);
                break;
+          case CLP_PARAM_DBL_WORKLIMIT:
+               model->setMaximumWorkUnits(value);
+               break;
           default:
                break;
           }
@@ -637,6 +640,11 @@ CbcOrClpParam::doubleParameter (ClpSimplex * model) const
      case CLP_PARAM_DBL_RHSSCALE:
           value = model->rhsScale();
           break;
+     case CLP_PARAM_DBL_WORKLIMIT:
+          value = model->maximumWorkUnits();
+          if (value >= 0.0)
+               value -= model->workUnits();
+          break;
      default:
           value = doubleValue_;
           break;
@@ -1524,6 +1532,15 @@ corrector algorithm.  You may want to link in an alternative \
 ordering and factorization.  It will also solve models \
 with quadratic objectives."
 
+     );
+     parameters[numberParameters++] =
+          CbcOrClpParam("basel!ine", "Set benchmark results to compare against",
+                        CLP_PARAM_ACTION_BASELINE, 3, 1);
+     parameters[numberParameters-1].setLonghelp
+     (
+          "This sets a CSV file written by an earlier benchmark.  A later benchmark \
+compares its best times and status against this and reports any model which is \
+slower by more than 25% (and 0.02 seconds) or which no longer solves."
      );
      parameters[numberParameters++] =
           CbcOrClpParam("basisI!n", "Import basis from bas file",
@@ -1533,7 +1550,7 @@ with quadratic objectives."
           "This will read an MPS format basis file from the given file name.  It will use the default\
  directory given by 'directory'.  A name of '$' will use the previous value for the name.  This\
  is initialized to '', i.e. it must be set.  If you have libz then it can read compressed\
- files 'xxxxxxxx.gz' or xxxxxxxx.bz2."
+ files 'xxxxxxxx.gz' or xxxxxxxx.bz2.  Binary basis files (see basisOut) are recognized automatically."
      );
      parameters[numberParameters++] =
           CbcOrClpParam("basisO!ut", "Export basis as bas file",
@@ -1542,7 +1559,28 @@ with quadratic objectives."
      (
           "This will write an MPS format basis file to the given file name.  It will use the default\
  directory given by 'directory'.  A name of '$' will use the previous value for the name.  This\
- is initialized to 'default.bas'."
+ is initialized to 'default.bas'.  If the name ends in .bin a compact binary basis without names\
+ or values is written instead, which is much faster for large models."
+     );
+     parameters[numberParameters++] =
+          CbcOrClpParam("bench!mark", "Time entire netlib test set",
+                        CLP_PARAM_ACTION_BENCHMARK, 3, 1);
+     parameters[numberParameters-1].setLonghelp
+     (
+          "This solves each netlib problem (from dirNetlib) with dual, primal, barrier and, \
+if built with Aboca, abc - benchmarkRuns times each.  Elapsed time (best and mean), \
+iterations (of last solve) and factorizations (from an extra untimed solve) are \
+written to the given file, as JSON if the name ends in .json and as CSV otherwise.  If a model is loaded then just that model is timed.  \
+If baseline is set the results are compared against it.  \
+The user can set options before e.g. clp -presolve off -benchmark bench.csv"
+     );
+     parameters[numberParameters++] =
+          CbcOrClpParam("benchmarkR!uns", "Number of times benchmark solves each model",
+                        1, 1000, CLP_PARAM_INT_BENCHMARKRUNS, 1);
+     parameters[numberParameters-1].setIntValue(3);
+     parameters[numberParameters-1].setLonghelp
+     (
+          "Best and mean elapsed times are taken over this many solves of each model and variant."
      );
      parameters[numberParameters++] =
           CbcOrClpParam("biasLU", "Whether factorization biased towards U",
@@ -1610,12 +1648,14 @@ have more rounds of cuts - see passC!uts and passT!ree."
 #else
      parameters[numberParameters-1].append("Mumps_dummy");
 #endif
+     parameters[numberParameters-1].append("single!Dense");
      parameters[numberParameters-1].setLonghelp
      (
           "For a barrier code to be effective it needs a good Cholesky ordering and factorization.  \
 The native ordering and factorization is not state of the art, although acceptable.  \
 You may want to link in one from another source.  See Makefile.locations for some \
-possibilities."
+possibilities.  singleDense is dense factorization done in single precision with \
+refinement in double, going back to double if refinement fails."
      );
      //#endif
 #ifdef COIN_HAS_CBC
@@ -2583,6 +2623,17 @@ stopping",
       \tsetMaximumIterations(value)\n can be useful.  If the code stops on\
  seconds or by an interrupt this will be treated as stopping on maximum iterations.  This is ignored in branchAndCut - use maxN!odes."
      );
+     parameters[numberParameters++] =
+          CbcOrClpParam("maxW!orkUnits", "Maximum deterministic work before \
+stopping",
+                        -1.0, 1.0e30, CLP_PARAM_DBL_WORKLIMIT);
+     parameters[numberParameters-1].setLonghelp
+     (
+          "Work units are a count of matrix and factorization elements touched by the simplex \
+method, so unlike seconds the point at which clp stops does not depend on the machine or \
+its load.  After this much work clp will act as if maximum iterations had been reached \
+(if value >=0).  The corresponding library call is setMaximumWorkUnits(value)."
+     );
 #endif
 #ifdef COIN_HAS_CBC
      parameters[numberParameters++] =
@@ -3161,6 +3212,21 @@ File is in csv format with allowed headings - name, number, priority, direction,
 See branchAndCut for information on options. \
 but strong options do more probing"
      );
+#endif
+#ifdef COIN_HAS_CLP
+     parameters[numberParameters++] =
+          CbcOrClpParam("prof!ile", "Whether to time phases of simplex iterations",
+                        "off", CLP_PARAM_STR_PROFILE);
+     parameters[numberParameters-1].append("on");
+     parameters[numberParameters-1].setLonghelp
+     (
+          "If on then elapsed time in ftran, btran, pricing, ratio test, \
+transposeTimes, factorization and update is printed after each solve.  \
+Times are exclusive so ftran done during pricing counts as ftran.  \
+Timing costs a little so this is off by default."
+     );
+#endif
+#ifdef COIN_HAS_CBC
      parameters[numberParameters++] =
           CbcOrClpParam("proximity!Search", "Whether to do proximity search heuristic",
                         "off", CBC_PARAM_STR_PROXIMITY);
@@ -58,6 +58,7 @@ enum CbcOrClpParameterType
      CLP_PARAM_DBL_OBJSCALE,
      CLP_PARAM_DBL_RHSSCALE,
      CLP_PARAM_DBL_ZEROTOLERANCE,
+     CLP_PARAM_DBL_WORKLIMIT,
 
      CBC_PARAM_DBL_INFEASIBILITYWEIGHT = 51,
      CBC_PARAM_DBL_CUTOFF,
@@ -103,6 +104,7 @@ enum CbcOrClpParameterType
      CLP_PARAM_INT_RANDOMSEED,
      CLP_PARAM_INT_MORESPECIALOPTIONS,
      CLP_PARAM_INT_DECOMPOSE_BLOCKS,
+     CLP_PARAM_INT_BENCHMARKRUNS,
 
      CBC_PARAM_INT_STRONGBRANCHING = 151,
      CBC_PARAM_INT_CUTDEPTH,
@@ -169,6 +171,7 @@ enum CbcOrClpParameterType
      CLP_PARAM_STR_ALLCOMMANDS,
      CLP_PARAM_STR_TIME_MODE,
      CLP_PARAM_STR_ABCWANTED,
+     CLP_PARAM_STR_PROFILE,
 
      CBC_PARAM_STR_NODESTRATEGY = 251,
      CBC_PARAM_STR_BRANCHSTRATEGY,
@@ -277,6 +280,8 @@ enum CbcOrClpParameterType
      CBC_PARAM_ACTION_USERCBC,
      CBC_PARAM_ACTION_DOHEURISTIC,
      CLP_PARAM_ACTION_NEXTBESTSOLUTION,
+     CLP_PARAM_ACTION_BENCHMARK,
+     CLP_PARAM_ACTION_BASELINE,
 
      CBC_PARAM_NOTUSED_OSLSTUFF = 401,
      CBC_PARAM_NOTUSED_CBCSTUFF,
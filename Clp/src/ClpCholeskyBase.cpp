@@ -293,6 +293,116 @@ ClpCholeskyBase * ClpCholeskyBase::clone() const
 {
      return new ClpCholeskyBase(*this);
 }
+// Number of columns taken out as dense
+int
+ClpCholeskyBase::numberDenseColumns() const
+{
+     return dense_ ? dense_->numberRows() : 0;
+}
+/* Chooses columns to take out of ADAT and handle by a dense
+   Schur complement.  If denseThreshold_ is zero a threshold is
+   found from distribution of column lengths.
+   used must have numberRows_+1 entries and is left zeroed.
+   Returns number of dense columns */
+int
+ClpCholeskyBase::chooseDense(int * used)
+{
+     delete [] whichDense_;
+     delete [] denseColumn_;
+     delete dense_;
+     whichDense_ = NULL;
+     denseColumn_ = NULL;
+     dense_ = NULL;
+     int numberColumns = model_->clpMatrix()->getNumCols();
+     const int * columnLength = model_->clpMatrix()->getVectorLengths();
+     int iColumn;
+     int iRow;
+     CoinZeroN(used, numberRows_ + 1);
+     CoinBigIndex numberElements = 0;
+     for (iColumn = 0; iColumn < numberColumns; iColumn++) {
+          int length = columnLength[iColumn];
+          used[length] += 1;
+          numberElements += length;
+     }
+     int threshold = denseThreshold_;
+     // maximum number of dense columns before Schur complement too big
+     int maximumDense = 100;
+     if (!threshold) {
+          // automatic - must be long compared to average and not too many
+          double average = static_cast<double>(numberElements) /
+                           static_cast<double>(CoinMax(numberColumns, 1));
+          int minimumLength = CoinMax(static_cast<int>(10.0 * average), 100);
+          maximumDense = CoinMin(50, numberColumns >> 2);
+          threshold = numberRows_ + 1;
+          int nLong = 0;
+          for (iRow = numberRows_; iRow >= minimumLength; iRow--) {
+               nLong += used[iRow];
+               if (nLong > maximumDense)
+                    break;
+               if (used[iRow])
+                    threshold = iRow;
+          }
+     } else {
+          int nLong = 0;
+          int stop = CoinMax(threshold / 2, 100);
+          for (iRow = numberRows_; iRow >= stop; iRow--) {
+               if (used[iRow])
+                    COIN_DETAIL_PRINT(printf("%d columns are of length %d\n", used[iRow], iRow));
+               nLong += used[iRow];
+               if (nLong > 50 || nLong > (numberColumns >> 2))
+                    break;
+          }
+     }
+     CoinZeroN(used, numberRows_ + 1);
+     int numberDense = 0;
+     if (threshold > numberRows_)
+          return 0;
+     whichDense_ = new char[numberColumns];
+     for (iColumn = 0; iColumn < numberColumns; iColumn++) {
+          if (columnLength[iColumn] < threshold) {
+               whichDense_[iColumn] = 0;
+          } else {
+               whichDense_[iColumn] = 1;
+               numberDense++;
+          }
+     }
+     if (numberDense && !denseThreshold_) {
+          /* Automatic - if a row is only in dense columns then sparse part
+             would be singular there and row would be dropped, so give up */
+          const CoinBigIndex * rowStart = rowCopy_->getVectorStarts();
+          const int * rowLength = rowCopy_->getVectorLengths();
+          const int * column = rowCopy_->getIndices();
+          for (iRow = 0; iRow < numberRows_; iRow++) {
+               CoinBigIndex startRow = rowStart[iRow];
+               CoinBigIndex endRow = startRow + rowLength[iRow];
+               if (startRow == endRow)
+                    continue;
+               CoinBigIndex k;
+               for (k = startRow; k < endRow; k++) {
+                    if (!whichDense_[column[k]])
+                         break;
+               }
+               if (k == endRow) {
+                    numberDense = 0;
+                    break;
+               }
+          }
+     }
+     if (!numberDense || numberDense > maximumDense) {
+          // free
+          delete [] whichDense_;
+          whichDense_ = NULL;
+          numberDense = 0;
+     } else {
+          // space for dense columns
+          denseColumn_ = new longDouble [numberDense*numberRows_];
+          // dense cholesky
+          dense_ = new ClpCholeskyDense();
+          dense_->reserveSpace(NULL, numberDense);
+          COIN_DETAIL_PRINT(printf("Taking %d columns as dense\n", numberDense));
+     }
+     return numberDense;
+}
 // Forms ADAT - returns nonzero if not enough memory
 int
 ClpCholeskyBase::preOrder(bool lowerTriangular, bool includeDiagonal, bool doKKT)
@@ -320,51 +430,8 @@ ClpCholeskyBase::preOrder(bool lowerTriangular, bool includeDiagonal, bool doKKT
           sizeFactor_ = 0;
           int numberColumns = model_->numberColumns();
           int numberDense = 0;
-          //denseThreshold_=3;
-          if (denseThreshold_ > 0) {
-               delete [] whichDense_;
-               delete [] denseColumn_;
-               delete dense_;
-               whichDense_ = new char[numberColumns];
-               int iColumn;
-               used[numberRows_] = 0;
-               for (iColumn = 0; iColumn < numberColumns; iColumn++) {
-                    int length = columnLength[iColumn];
-                    used[length] += 1;
-               }
-               int nLong = 0;
-               int stop = CoinMax(denseThreshold_ / 2, 100);
-               for (iRow = numberRows_; iRow >= stop; iRow--) {
-                    if (used[iRow])
-		      COIN_DETAIL_PRINT(printf("%d columns are of length %d\n", used[iRow], iRow));
-                    nLong += used[iRow];
-                    if (nLong > 50 || nLong > (numberColumns >> 2))
-                         break;
-               }
-               CoinZeroN(used, numberRows_);
-               for (iColumn = 0; iColumn < numberColumns; iColumn++) {
-                    if (columnLength[iColumn] < denseThreshold_) {
-                         whichDense_[iColumn] = 0;
-                    } else {
-                         whichDense_[iColumn] = 1;
-                         numberDense++;
-                    }
-               }
-               if (!numberDense || numberDense > 100) {
-                    // free
-                    delete [] whichDense_;
-                    whichDense_ = NULL;
-                    denseColumn_ = NULL;
-                    dense_ = NULL;
-               } else {
-                    // space for dense columns
-                    denseColumn_ = new longDouble [numberDense*numberRows_];
-                    // dense cholesky
-                    dense_ = new ClpCholeskyDense();
-                    dense_->reserveSpace(NULL, numberDense);
-                    COIN_DETAIL_PRINT(printf("Taking %d columns as dense\n", numberDense));
-               }
-          }
+          if (denseThreshold_ >= 0)
+               numberDense = chooseDense(used);
           int offset = includeDiagonal ? 0 : 1;
           if (lowerTriangular)
                offset = -offset;
@@ -687,50 +754,8 @@ ClpCholeskyBase::order(ClpInterior * model)
           permute_[iRow] = iRow;
      if (!doKKT_) {
           int numberDense = 0;
-          if (denseThreshold_ > 0) {
-               delete [] whichDense_;
-               delete [] denseColumn_;
-               delete dense_;
-               whichDense_ = new char[numberColumns];
-               int iColumn;
-               used[numberRows_] = 0;
-               for (iColumn = 0; iColumn < numberColumns; iColumn++) {
-                    int length = columnLength[iColumn];
-                    used[length] += 1;
-               }
-               int nLong = 0;
-               int stop = CoinMax(denseThreshold_ / 2, 100);
-               for (iRow = numberRows_; iRow >= stop; iRow--) {
-                    if (used[iRow])
-		      COIN_DETAIL_PRINT(printf("%d columns are of length %d\n", used[iRow], iRow));
-                    nLong += used[iRow];
-                    if (nLong > 50 || nLong > (numberColumns >> 2))
-                         break;
-               }
-               CoinZeroN(used, numberRows_);
-               for (iColumn = 0; iColumn < numberColumns; iColumn++) {
-                    if (columnLength[iColumn] < denseThreshold_) {
-                         whichDense_[iColumn] = 0;
-                    } else {
-                         whichDense_[iColumn] = 1;
-                         numberDense++;
-                    }
-               }
-               if (!numberDense || numberDense > 100) {
-                    // free
-                    delete [] whichDense_;
-                    whichDense_ = NULL;
-                    denseColumn_ = NULL;
-                    dense_ = NULL;
-               } else {
-                    // space for dense columns
-                    denseColumn_ = new longDouble [numberDense*numberRows_];
-                    // dense cholesky
-                    dense_ = new ClpCholeskyDense();
-                    dense_->reserveSpace(NULL, numberDense);
-                    COIN_DETAIL_PRINT(printf("Taking %d columns as dense\n", numberDense));
-               }
-          }
+          if (denseThreshold_ >= 0)
+               numberDense = chooseDense(used);
           /*
              Get row counts and size
           */
@@ -2833,26 +2858,27 @@ ClpCholeskyBase::factorize(const CoinWorkDouble * diagonal, int * rowsDropped)
                // Zero out dropped rows
                for (i = 0; i < numberDense; i++) {
                     longDouble * a = denseColumn_ + i * numberRows_;
-                    for (int j = 0; j < numberRows_; j++) {
-                         if (rowsDropped[j])
-                              a[j] = 0.0;
-                    }
-                    for (i = 0; i < numberRows_; i++) {
-                         int iRow = permute_[i];
-                         workDouble_[i] = a[iRow];
-                    }
-                    for (i = 0; i < numberRows_; i++) {
-                         CoinWorkDouble value = workDouble_[i];
-                         CoinBigIndex offset = indexStart_[i] - choleskyStart_[i];
+                    int k;
+                    for (k = 0; k < numberRows_; k++) {
+                         if (rowsDropped[k])
+                              a[k] = 0.0;
+                    }
+                    for (k = 0; k < numberRows_; k++) {
+                         int iRow = permute_[k];
+                         workDouble_[k] = a[iRow];
+                    }
+                    for (k = 0; k < numberRows_; k++) {
+                         CoinWorkDouble value = workDouble_[k];
+                         CoinBigIndex offset = indexStart_[k] - choleskyStart_[k];
                          CoinBigIndex j;
-                         for (j = choleskyStart_[i]; j < choleskyStart_[i+1]; j++) {
+                         for (j = choleskyStart_[k]; j < choleskyStart_[k+1]; j++) {
                               int iRow = choleskyRow_[j+offset];
                               workDouble_[iRow] -= sparseFactor_[j] * value;
                          }
                     }
-                    for (i = 0; i < numberRows_; i++) {
-                         int iRow = permute_[i];
-                         a[iRow] = workDouble_[i] * diagonal_[i];
+                    for (k = 0; k < numberRows_; k++) {
+                         int iRow = permute_[k];
+                         a[iRow] = workDouble_[k] * diagonal_[k];
                     }
                }
                dense_->resetRowsDropped();
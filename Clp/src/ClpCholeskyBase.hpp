@@ -110,6 +110,18 @@ public:
      inline void setGoDense(double value) {
           goDense_ = value;
      }
+     /** Dense threshold.  Columns with at least this many elements are
+         taken out of ADAT and handled through a dense Schur complement.
+         0 chooses automatically, negative is off */
+     inline int denseThreshold() const {
+          return denseThreshold_;
+     }
+     /// Set dense threshold (0 automatic, negative off)
+     inline void setDenseThreshold(int value) {
+          denseThreshold_ = value;
+     }
+     /// Number of columns taken out as dense
+     int numberDenseColumns() const;
      /// rank.  Returns rank
      inline int rank() const {
           return numberRows_ - numberRowsDropped_;
@@ -167,6 +179,8 @@ public:
       */
      //@{
      /** Constructor which has dense columns activated.
+         If denseThreshold > 0 columns with at least that many elements
+         are dense, if 0 dense columns are found automatically.
          Default is off. */
      ClpCholeskyBase(int denseThreshold = -1);
      /** Destructor (has to be public) */
@@ -218,6 +232,9 @@ protected:
      void solve(CoinWorkDouble * region, int type);
      /// Forms ADAT - returns nonzero if not enough memory
      int preOrder(bool lowerTriangular, bool includeDiagonal, bool doKKT);
+     /** Chooses dense columns and sets up space for them.
+         used must be of size numberRows_+1.  Returns number dense */
+     int chooseDense(int * used);
      /// Updates dense part (broken out for profiling)
      void updateDense(longDouble * d, /*longDouble * work,*/ int * first);
      //@}
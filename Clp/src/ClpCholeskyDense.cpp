@@ -25,6 +25,34 @@
 #define cilk_sync
 #endif
 
+/* If not power of 2 then need to redo a bit*/
+#define BLOCK 16
+#define BLOCKSHIFT 4
+/* Block unroll if power of 2 and at least 8*/
+#define BLOCKUNROLL
+
+#define BLOCKSQ ( BLOCK*BLOCK )
+#define BLOCKSQSHIFT ( BLOCKSHIFT+BLOCKSHIFT )
+#define number_blocks(x) (((x)+BLOCK-1)>>BLOCKSHIFT)
+#define number_rows(x) ((x)<<BLOCKSHIFT)
+#define number_entries(x) ((x)<<BLOCKSQSHIFT)
+/* Size of single precision factor*/
+static CoinBigIndex floatFactorSize(int numberRows)
+{
+     int numberBlocks = number_blocks(numberRows);
+     return number_entries((numberBlocks * (numberBlocks + 1)) >> 1);
+}
+/* Copies single precision factor*/
+static float * copyFloatFactor(const float * floatFactor, int numberRows)
+{
+     if (!floatFactor)
+          return NULL;
+     CoinBigIndex size = floatFactorSize(numberRows);
+     float * copy = new float [size];
+     CoinMemcpyN(floatFactor, size, copy);
+     return copy;
+}
+
 /*#############################################################################*/
 /* Constructors / Destructor / Assignment*/
 /*#############################################################################*/
@@ -34,7 +62,10 @@
 /*-------------------------------------------------------------------*/
 ClpCholeskyDense::ClpCholeskyDense ()
      : ClpCholeskyBase(),
-       borrowSpace_(false)
+       borrowSpace_(false),
+       singlePrecision_(false),
+       floatFactor_(NULL),
+       floatRowsDropped_(NULL)
 {
      type_ = 11;;
 }
@@ -44,9 +75,12 @@ ClpCholeskyDense::ClpCholeskyDense ()
 /*-------------------------------------------------------------------*/
 ClpCholeskyDense::ClpCholeskyDense (const ClpCholeskyDense & rhs)
      : ClpCholeskyBase(rhs),
-       borrowSpace_(rhs.borrowSpace_)
+       borrowSpace_(rhs.borrowSpace_),
+       singlePrecision_(rhs.singlePrecision_)
 {
      assert(!rhs.borrowSpace_ || !rhs.sizeFactor_); /* can't do if borrowing space*/
+     floatFactor_ = copyFloatFactor(rhs.floatFactor_, numberRows_);
+     floatRowsDropped_ = CoinCopyOfArray(rhs.floatRowsDropped_, numberRows_);
 }
 
 
@@ -55,6 +89,8 @@ ClpCholeskyDense::ClpCholeskyDense (const ClpCholeskyDense & rhs)
 /*-------------------------------------------------------------------*/
 ClpCholeskyDense::~ClpCholeskyDense ()
 {
+     delete [] floatFactor_;
+     delete [] floatRowsDropped_;
      if (borrowSpace_) {
           /* set NULL*/
           sparseFactor_ = NULL;
@@ -73,6 +109,11 @@ ClpCholeskyDense::operator=(const ClpCholeskyDense& rhs)
           assert(!rhs.borrowSpace_ || !rhs.sizeFactor_); /* can't do if borrowing space*/
           ClpCholeskyBase::operator=(rhs);
           borrowSpace_ = rhs.borrowSpace_;
+          singlePrecision_ = rhs.singlePrecision_;
+          delete [] floatFactor_;
+          floatFactor_ = copyFloatFactor(rhs.floatFactor_, numberRows_);
+          delete [] floatRowsDropped_;
+          floatRowsDropped_ = CoinCopyOfArray(rhs.floatRowsDropped_, numberRows_);
      }
      return *this;
 }
@@ -83,17 +124,6 @@ ClpCholeskyBase * ClpCholeskyDense::clone() const
 {
      return new ClpCholeskyDense(*this);
 }
-/* If not power of 2 then need to redo a bit*/
-#define BLOCK 16
-#define BLOCKSHIFT 4
-/* Block unroll if power of 2 and at least 8*/
-#define BLOCKUNROLL
-
-#define BLOCKSQ ( BLOCK*BLOCK )
-#define BLOCKSQSHIFT ( BLOCKSHIFT+BLOCKSHIFT )
-#define number_blocks(x) (((x)+BLOCK-1)>>BLOCKSHIFT)
-#define number_rows(x) ((x)<<BLOCKSHIFT)
-#define number_entries(x) ((x)<<BLOCKSQSHIFT)
 /* Gets space */
 int
 ClpCholeskyDense::reserveSpace(const ClpCholeskyBase * factor, int numberRows)
@@ -640,6 +670,40 @@ ClpCholeskyDense::factorizePart2( int * rowsDropped)
           nBlock++;
           block -= nBlock + ifOdd;
      }
+     delete [] floatFactor_;
+     floatFactor_ = NULL;
+     delete [] floatRowsDropped_;
+     floatRowsDropped_ = NULL;
+     if (!singlePrecision_ || borrowSpace_ ||
+               !factorizeSingle(a, numberBlocks, rowsDropped))
+          factorizeDouble(rowsDropped);
+     diagonalStatistics();
+}
+/* Updates diagonal statistics after a blocked factorization */
+void
+ClpCholeskyDense::diagonalStatistics()
+{
+     double largest = 0.0;
+     double smallest = COIN_DBL_MAX;
+     int numberDropped = 0;
+     for (int i = 0; i < numberRows_; i++) {
+          if (diagonal_[i]) {
+               largest = CoinMax(largest, CoinAbs(diagonal_[i]));
+               smallest = CoinMin(smallest, CoinAbs(diagonal_[i]));
+          } else {
+               numberDropped++;
+          }
+     }
+     doubleParameters_[3] = CoinMax(doubleParameters_[3], 1.0 / smallest);
+     doubleParameters_[4] = CoinMin(doubleParameters_[4], 1.0 / largest);
+     integerParameters_[20] += numberDropped;
+}
+/* Factorizes blocked matrix in place in double */
+void
+ClpCholeskyDense::factorizeDouble(int * rowsDropped)
+{
+     int numberBlocks = number_blocks(numberRows_);
+     longDouble * a = sparseFactor_ + BLOCKSQ * numberBlocks;
      ClpCholeskyDenseC  info;
      info.diagonal_ = diagonal_;
      info.doubleParameters_[0] = doubleParameters_[10];
@@ -656,20 +720,329 @@ ClpCholeskyDense::factorizePart2( int * rowsDropped)
      info.integerParameters_[1] = model_->numberThreads();
      ClpCholeskySpawn(&info);
 #endif
-     double largest = 0.0;
-     double smallest = COIN_DBL_MAX;
-     int numberDropped = 0;
-     for (int i = 0; i < numberRows_; i++) {
-          if (diagonal_[i]) {
-               largest = CoinMax(largest, CoinAbs(diagonal_[i]));
-               smallest = CoinMin(smallest, CoinAbs(diagonal_[i]));
-          } else {
-               numberDropped++;
+}
+/* Offset (in blocks) of block iBlock,jBlock (iBlock>=jBlock)*/
+static inline int blockOffset(int iBlock, int jBlock, int numberBlocks)
+{
+     return jBlock * numberBlocks - ((jBlock * (jBlock - 1)) >> 1) + iBlock - jBlock;
+}
+/* Factorizes blocked matrix a into floatFactor_.
+   Same layout as double version but right looking so that
+   all inner loops are contiguous in float */
+bool
+ClpCholeskyDense::factorizeSingle(const longDouble * a, int numberBlocks, int * rowsDropped)
+{
+     int n = numberRows_;
+     CoinBigIndex size = floatFactorSize(n);
+     CoinBigIndex iElement;
+     /* values must fit comfortably in a float*/
+     for (iElement = 0; iElement < size; iElement++) {
+          if (CoinAbs(a[iElement]) > 1.0e30) {
+               singlePrecision_ = false;
+               return false;
           }
      }
-     doubleParameters_[3] = CoinMax(doubleParameters_[3], 1.0 / smallest);
-     doubleParameters_[4] = CoinMin(doubleParameters_[4], 1.0 / largest);
-     integerParameters_[20] += numberDropped;
+     double dropValue = doubleParameters_[10];
+     int firstPositive = integerParameters_[34];
+     int * saveDropped = CoinCopyOfArray(rowsDropped, n);
+     float * COIN_RESTRICT factor = new float [size];
+     for (iElement = 0; iElement < size; iElement++)
+          factor[iElement] = static_cast<float>(a[iElement]);
+     float * pivot = new float [number_rows(numberBlocks)];
+     for (int jBlock = 0; jBlock < numberBlocks; jBlock++) {
+          int jBase = number_rows(jBlock);
+          int nJ = CoinMin(BLOCK, n - jBase);
+          float * COIN_RESTRICT aJJ = factor + number_entries(blockOffset(jBlock, jBlock, numberBlocks));
+          float * COIN_RESTRICT d = pivot + jBase;
+          int j, k;
+          /* diagonal block*/
+          for (j = 0; j < nJ; j++) {
+               float * COIN_RESTRICT aj = aJJ + j * BLOCK;
+               CoinWorkDouble t00 = aj[j];
+               for (k = 0; k < j; k++)
+                    t00 -= aJJ[j+k*BLOCK] * aJJ[j+k*BLOCK] * d[k];
+               bool dropColumn;
+               if (j + jBase < firstPositive)
+                    dropColumn = !(t00 <= -dropValue);
+               else
+                    dropColumn = !(t00 >= dropValue);
+               if (!dropColumn) {
+                    d[j] = static_cast<float>(t00);
+                    float inverse = static_cast<float>(1.0 / t00);
+                    diagonal_[jBase+j] = inverse;
+                    for (k = 0; k < j; k++) {
+                         float multiplier = aJJ[j+k*BLOCK] * d[k];
+                         const float * COIN_RESTRICT ak = aJJ + k * BLOCK;
+                         for (int i = j + 1; i < nJ; i++)
+                              aj[i] -= ak[i] * multiplier;
+                    }
+                    for (int i = j + 1; i < nJ; i++)
+                         aj[i] *= inverse;
+               } else if (!saveDropped[jBase+j]) {
+                    /* float not good enough to decide - do in double*/
+                    break;
+               } else {
+                    /* drop column*/
+                    rowsDropped[jBase+j] = 2;
+                    diagonal_[jBase+j] = 0.0;
+                    d[j] = 0.0f;
+                    for (int i = j + 1; i < nJ; i++)
+                         aj[i] = 0.0f;
+               }
+          }
+          if (j < nJ) {
+               delete [] pivot;
+               delete [] factor;
+               delete [] saveDropped;
+               singlePrecision_ = false;
+               return false;
+          }
+          /* blocks under diagonal*/
+          for (int iBlock = jBlock + 1; iBlock < numberBlocks; iBlock++) {
+               int nI = CoinMin(BLOCK, n - number_rows(iBlock));
+               float * COIN_RESTRICT aIJ = aJJ + number_entries(iBlock - jBlock);
+               for (j = 0; j < nJ; j++) {
+                    float * COIN_RESTRICT aj = aIJ + j * BLOCK;
+                    for (k = 0; k < j; k++) {
+                         float multiplier = aJJ[j+k*BLOCK] * d[k];
+                         const float * COIN_RESTRICT ak = aIJ + k * BLOCK;
+                         for (int i = 0; i < nI; i++)
+                              aj[i] -= ak[i] * multiplier;
+                    }
+                    float inverse = static_cast<float>(diagonal_[jBase+j]);
+                    for (int i = 0; i < nI; i++)
+                         aj[i] *= inverse;
+               }
+          }
+          /* update trailing matrix*/
+          for (int kBlock = jBlock + 1; kBlock < numberBlocks; kBlock++) {
+               int nK = CoinMin(BLOCK, n - number_rows(kBlock));
+               const float * COIN_RESTRICT aKJ = aJJ + number_entries(kBlock - jBlock);
+               float * COIN_RESTRICT aKK = factor + number_entries(blockOffset(kBlock, kBlock, numberBlocks));
+               for (int iBlock = kBlock; iBlock < numberBlocks; iBlock++) {
+                    int nI = CoinMin(BLOCK, n - number_rows(iBlock));
+                    const float * COIN_RESTRICT aIJ = aJJ + number_entries(iBlock - jBlock);
+                    float * COIN_RESTRICT aIK = aKK + number_entries(iBlock - kBlock);
+                    for (k = 0; k < nK; k++) {
+                         float * COIN_RESTRICT ak = aIK + k * BLOCK;
+                         if (nI == BLOCK && iBlock != kBlock) {
+                              /* full block - keep column in registers*/
+                              float t[BLOCK];
+                              int i;
+                              for (i = 0; i < BLOCK; i++)
+                                   t[i] = ak[i];
+                              for (j = 0; j < nJ; j++) {
+                                   float multiplier = aKJ[k+j*BLOCK] * d[j];
+                                   const float * COIN_RESTRICT aj = aIJ + j * BLOCK;
+                                   for (i = 0; i < BLOCK; i++)
+                                        t[i] -= aj[i] * multiplier;
+                              }
+                              for (i = 0; i < BLOCK; i++)
+                                   ak[i] = t[i];
+                         } else {
+                              int first = (iBlock == kBlock) ? k : 0;
+                              for (j = 0; j < nJ; j++) {
+                                   float multiplier = aKJ[k+j*BLOCK] * d[j];
+                                   const float * COIN_RESTRICT aj = aIJ + j * BLOCK;
+                                   for (int i = first; i < nI; i++)
+                                        ak[i] -= aj[i] * multiplier;
+                              }
+                         }
+                    }
+               }
+          }
+     }
+     delete [] pivot;
+     floatFactor_ = factor;
+     /* check refinement works on a simple right hand side*/
+     CoinWorkDouble * region = new CoinWorkDouble [2*n];
+     CoinWorkDouble * ones = region + n;
+     for (int iRow = 0; iRow < n; iRow++)
+          ones[iRow] = rowsDropped[iRow] ? 0.0 : 1.0;
+     multiplyOriginal(ones, region);
+     bool goodFactor = solveRefined(region);
+     delete [] region;
+     if (!goodFactor) {
+          delete [] floatFactor_;
+          floatFactor_ = NULL;
+          CoinMemcpyN(saveDropped, n, rowsDropped);
+          singlePrecision_ = false;
+          delete [] saveDropped;
+     } else {
+          /* keep in case a later solve has to go to double*/
+          floatRowsDropped_ = saveDropped;
+     }
+     return goodFactor;
+}
+/* Solves using floatFactor_ */
+void
+ClpCholeskyDense::solveSingle(CoinWorkDouble * region) const
+{
+     int n = numberRows_;
+     int numberBlocks = number_blocks(n);
+     int iBlock, kBlock;
+     int i, j;
+     /* forward - L is unit lower triangular*/
+     const float * aa = floatFactor_;
+     for (iBlock = 0; iBlock < numberBlocks; iBlock++) {
+          int iBase = number_rows(iBlock);
+          int nI = CoinMin(BLOCK, n - iBase);
+          CoinWorkDouble * regionI = region + iBase;
+          for (j = 0; j < nI; j++) {
+               CoinWorkDouble value = regionI[j];
+               const float * aj = aa + j * BLOCK;
+               for (i = j + 1; i < nI; i++)
+                    regionI[i] -= value * aj[i];
+          }
+          aa += BLOCKSQ;
+          for (kBlock = iBlock + 1; kBlock < numberBlocks; kBlock++) {
+               int kBase = number_rows(kBlock);
+               int nK = CoinMin(BLOCK, n - kBase);
+               CoinWorkDouble * regionK = region + kBase;
+               for (j = 0; j < nI; j++) {
+                    CoinWorkDouble value = regionI[j];
+                    const float * aj = aa + j * BLOCK;
+                    for (i = 0; i < nK; i++)
+                         regionK[i] -= value * aj[i];
+               }
+               aa += BLOCKSQ;
+          }
+     }
+     for (i = 0; i < n; i++)
+          region[i] *= diagonal_[i];
+     /* backward*/
+     for (iBlock = numberBlocks - 1; iBlock >= 0; iBlock--) {
+          int iBase = number_rows(iBlock);
+          int nI = CoinMin(BLOCK, n - iBase);
+          CoinWorkDouble * regionI = region + iBase;
+          const float * aI = floatFactor_ + number_entries(blockOffset(iBlock, iBlock, numberBlocks));
+          for (kBlock = numberBlocks - 1; kBlock > iBlock; kBlock--) {
+               int kBase = number_rows(kBlock);
+               int nK = CoinMin(BLOCK, n - kBase);
+               const CoinWorkDouble * regionK = region + kBase;
+               const float * aKI = aI + number_entries(kBlock - iBlock);
+               for (j = 0; j < nI; j++) {
+                    CoinWorkDouble value = regionI[j];
+                    const float * aj = aKI + j * BLOCK;
+                    for (i = 0; i < nK; i++)
+                         value -= aj[i] * regionK[i];
+                    regionI[j] = value;
+               }
+          }
+          for (j = nI - 1; j >= 0; j--) {
+               CoinWorkDouble value = regionI[j];
+               const float * aj = aI + j * BLOCK;
+               for (i = j + 1; i < nI; i++)
+                    value -= aj[i] * regionI[i];
+               regionI[j] = value;
+          }
+     }
+}
+/* region2 = original blocked matrix times region*/
+void
+ClpCholeskyDense::multiplyOriginal(const CoinWorkDouble * region, CoinWorkDouble * region2) const
+{
+     int n = numberRows_;
+     int numberBlocks = number_blocks(n);
+     const longDouble * aa = sparseFactor_ + BLOCKSQ * numberBlocks;
+     CoinZeroN(region2, n);
+     for (int jBlock = 0; jBlock < numberBlocks; jBlock++) {
+          int jBase = number_rows(jBlock);
+          int nJ = CoinMin(BLOCK, n - jBase);
+          const CoinWorkDouble * regionJ = region + jBase;
+          CoinWorkDouble * region2J = region2 + jBase;
+          int i, j;
+          for (j = 0; j < nJ; j++) {
+               const longDouble * aj = aa + j * BLOCK;
+               CoinWorkDouble valueJ = regionJ[j];
+               CoinWorkDouble value = aj[j] * valueJ;
+               for (i = j + 1; i < nJ; i++) {
+                    value += aj[i] * regionJ[i];
+                    region2J[i] += aj[i] * valueJ;
+               }
+               region2J[j] += value;
+          }
+          aa += BLOCKSQ;
+          for (int iBlock = jBlock + 1; iBlock < numberBlocks; iBlock++) {
+               int iBase = number_rows(iBlock);
+               int nI = CoinMin(BLOCK, n - iBase);
+               const CoinWorkDouble * regionI = region + iBase;
+               CoinWorkDouble * region2I = region2 + iBase;
+               for (j = 0; j < nJ; j++) {
+                    const longDouble * aj = aa + j * BLOCK;
+                    CoinWorkDouble valueJ = regionJ[j];
+                    CoinWorkDouble value = 0.0;
+                    for (i = 0; i < nI; i++) {
+                         value += aj[i] * regionI[i];
+                         region2I[i] += aj[i] * valueJ;
+                    }
+                    region2J[j] += value;
+               }
+               aa += BLOCKSQ;
+          }
+     }
+}
+/* Solves using floatFactor_ and iterative refinement in double.
+   Returns false if refinement does not converge */
+bool
+ClpCholeskyDense::solveRefined(CoinWorkDouble * region) const
+{
+     int n = numberRows_;
+     int numberBlocks = number_blocks(n);
+     const longDouble * a = sparseFactor_ + BLOCKSQ * numberBlocks;
+     CoinWorkDouble * rhs = new CoinWorkDouble [2*n];
+     CoinWorkDouble * residual = rhs + n;
+     CoinMemcpyN(region, n, rhs);
+     /* scale for residual*/
+     CoinWorkDouble rhsNorm = 0.0;
+     CoinWorkDouble largestDiagonal = 0.0;
+     int i;
+     for (int iBlock = 0; iBlock < numberBlocks; iBlock++) {
+          int iBase = number_rows(iBlock);
+          int nI = CoinMin(BLOCK, n - iBase);
+          const longDouble * aI = a + number_entries(blockOffset(iBlock, iBlock, numberBlocks));
+          for (i = 0; i < nI; i++) {
+               if (diagonal_[iBase+i]) {
+                    largestDiagonal = CoinMax(largestDiagonal, CoinAbs(aI[i+i*BLOCK]));
+                    rhsNorm = CoinMax(rhsNorm, CoinAbs(rhs[iBase+i]));
+               }
+          }
+     }
+     solveSingle(region);
+     bool converged = false;
+     CoinWorkDouble lastNorm = COIN_DBL_MAX;
+     for (int iPass = 0; iPass < 10; iPass++) {
+          multiplyOriginal(region, residual);
+          CoinWorkDouble residualNorm = 0.0;
+          CoinWorkDouble solutionNorm = 0.0;
+          for (i = 0; i < n; i++) {
+               if (diagonal_[i]) {
+                    CoinWorkDouble value = rhs[i] - residual[i];
+                    if (CoinIsnan(value))
+                         residualNorm = COIN_DBL_MAX;
+                    residual[i] = value;
+                    residualNorm = CoinMax(residualNorm, CoinAbs(value));
+                    solutionNorm = CoinMax(solutionNorm, CoinAbs(region[i]));
+               } else {
+                    residual[i] = 0.0;
+               }
+          }
+          CoinWorkDouble scale = rhsNorm + largestDiagonal * solutionNorm;
+          if (residualNorm <= 1.0e-12 * scale) {
+               converged = true;
+               break;
+          } else if (residualNorm > 0.5 * lastNorm) {
+               /* stalled - accept if as good as double would be*/
+               converged = (residualNorm <= 1.0e-10 * scale);
+               break;
+          }
+          lastNorm = residualNorm;
+          solveSingle(residual);
+          for (i = 0; i < n; i++)
+               region[i] += residual[i];
+     }
+     delete [] rhs;
+     return converged;
 }
 /* Non leaf recursive factor*/
 void
@@ -1037,6 +1410,151 @@ void ClpCholeskyCrecTriLeaf(/*ClpCholeskyDenseC * thisStruct,*/ longDouble * aUn
      }
 #endif
 }
+/* Full block rectangle rectangle update for double precision.
+   Columns of aOther are held in registers as whole vectors and updated
+   with a multiply-add for each k - the same register blocking as the
+   scalar 4x4 code but across whole columns.  With gcc or clang on x86_64
+   there are AVX2/FMA and AVX-512 versions, compiled whatever the build
+   flags, and the widest the machine has is picked on first use, otherwise
+   the scalar code is used.  Define CLP_NO_CHOLESKY_SIMD to always use
+   scalar code.
+*/
+#if CLP_LONG_CHOLESKY==0 && COIN_LONG_WORK==0 && BLOCK==16 && defined(__GNUC__) \
+  && !defined(__INTEL_COMPILER) && defined(__x86_64__) && !defined(CLP_NO_CHOLESKY_SIMD) \
+  && (__GNUC__ >= 5 || defined(__clang__))
+#define CLP_CHOLESKY_SIMD
+/* four doubles - may be unaligned as blocks are only aligned on doubles */
+typedef double ClpCholeskyVector __attribute__((vector_size(32), may_alias, aligned(8)));
+/* eight doubles */
+typedef double ClpCholeskyVector8 __attribute__((vector_size(64), may_alias, aligned(8)));
+/* AVX2 - two columns as four vectors each */
+__attribute__((target("avx2,fma"))) static void
+ClpCholeskyCrecRecFull(const longDouble * COIN_RESTRICT above,
+                       const longDouble * COIN_RESTRICT aUnder,
+                       longDouble * COIN_RESTRICT aOther,
+                       const longDouble * COIN_RESTRICT work)
+{
+     for (int j = 0; j < BLOCK; j += 2) {
+          ClpCholeskyVector * COIN_RESTRICT aa =
+               reinterpret_cast<ClpCholeskyVector *>(aOther + j * BLOCK);
+          ClpCholeskyVector t00 = aa[0];
+          ClpCholeskyVector t01 = aa[1];
+          ClpCholeskyVector t02 = aa[2];
+          ClpCholeskyVector t03 = aa[3];
+          ClpCholeskyVector t10 = aa[4];
+          ClpCholeskyVector t11 = aa[5];
+          ClpCholeskyVector t12 = aa[6];
+          ClpCholeskyVector t13 = aa[7];
+          const longDouble * COIN_RESTRICT aboveNow = above + j;
+          for (int k = 0; k < BLOCK; k++) {
+               const ClpCholeskyVector * COIN_RESTRICT aUnderNow =
+                    reinterpret_cast<const ClpCholeskyVector *>(aUnder + k * BLOCK);
+               ClpCholeskyVector a0 = aUnderNow[0];
+               ClpCholeskyVector a1 = aUnderNow[1];
+               ClpCholeskyVector a2 = aUnderNow[2];
+               ClpCholeskyVector a3 = aUnderNow[3];
+               double m0 = aboveNow[0] * work[k];
+               double m1 = aboveNow[1] * work[k];
+               t00 -= a0 * m0;
+               t01 -= a1 * m0;
+               t02 -= a2 * m0;
+               t03 -= a3 * m0;
+               t10 -= a0 * m1;
+               t11 -= a1 * m1;
+               t12 -= a2 * m1;
+               t13 -= a3 * m1;
+               aboveNow += BLOCK;
+          }
+          aa[0] = t00;
+          aa[1] = t01;
+          aa[2] = t02;
+          aa[3] = t03;
+          aa[4] = t10;
+          aa[5] = t11;
+          aa[6] = t12;
+          aa[7] = t13;
+     }
+}
+/* AVX-512 - four columns as two vectors each */
+__attribute__((target("avx512f"))) static void
+ClpCholeskyCrecRecFull8(const longDouble * COIN_RESTRICT above,
+                        const longDouble * COIN_RESTRICT aUnder,
+                        longDouble * COIN_RESTRICT aOther,
+                        const longDouble * COIN_RESTRICT work)
+{
+     for (int j = 0; j < BLOCK; j += 4) {
+          ClpCholeskyVector8 * COIN_RESTRICT aa =
+               reinterpret_cast<ClpCholeskyVector8 *>(aOther + j * BLOCK);
+          ClpCholeskyVector8 t00 = aa[0];
+          ClpCholeskyVector8 t01 = aa[1];
+          ClpCholeskyVector8 t10 = aa[2];
+          ClpCholeskyVector8 t11 = aa[3];
+          ClpCholeskyVector8 t20 = aa[4];
+          ClpCholeskyVector8 t21 = aa[5];
+          ClpCholeskyVector8 t30 = aa[6];
+          ClpCholeskyVector8 t31 = aa[7];
+          const longDouble * COIN_RESTRICT aboveNow = above + j;
+          for (int k = 0; k < BLOCK; k++) {
+               const ClpCholeskyVector8 * COIN_RESTRICT aUnderNow =
+                    reinterpret_cast<const ClpCholeskyVector8 *>(aUnder + k * BLOCK);
+               ClpCholeskyVector8 a0 = aUnderNow[0];
+               ClpCholeskyVector8 a1 = aUnderNow[1];
+               double m0 = aboveNow[0] * work[k];
+               double m1 = aboveNow[1] * work[k];
+               double m2 = aboveNow[2] * work[k];
+               double m3 = aboveNow[3] * work[k];
+               t00 -= a0 * m0;
+               t01 -= a1 * m0;
+               t10 -= a0 * m1;
+               t11 -= a1 * m1;
+               t20 -= a0 * m2;
+               t21 -= a1 * m2;
+               t30 -= a0 * m3;
+               t31 -= a1 * m3;
+               aboveNow += BLOCK;
+          }
+          aa[0] = t00;
+          aa[1] = t01;
+          aa[2] = t10;
+          aa[3] = t11;
+          aa[4] = t20;
+          aa[5] = t21;
+          aa[6] = t30;
+          aa[7] = t31;
+     }
+}
+/* 0 scalar, 1 AVX2, 2 AVX-512 */
+static int
+ClpCholeskySimdDetect()
+{
+     __builtin_cpu_init();
+     if (__builtin_cpu_supports("avx512f"))
+          return 2;
+     else if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma"))
+          return 1;
+     else
+          return 0;
+}
+/* local static so initialization is done once even with threads */
+static inline int
+ClpCholeskySimdType()
+{
+     static const int simdType = ClpCholeskySimdDetect();
+     return simdType;
+}
+static int ClpCholeskySimdMaximum = 2;
+#endif
+/* Limits vector code used by rectangle update */
+int
+ClpCholeskySetSimdLevel(int maximumLevel)
+{
+#ifdef CLP_CHOLESKY_SIMD
+     ClpCholeskySimdMaximum = maximumLevel;
+     return CoinMin(ClpCholeskySimdType(), maximumLevel);
+#else
+     return 0;
+#endif
+}
 /* Leaf recursive rectangle rectangle update,
    nUnder is number of rows in iBlock,
    nUnderK is number of rows in kBlock
@@ -1066,6 +1584,16 @@ ClpCholeskyCrecRecLeaf(/*ClpCholeskyDenseC * thisStruct,*/
      aa = aOther - 4 * BLOCK;
      if (nUnder == BLOCK) {
           /*#define INTEL*/
+#ifdef CLP_CHOLESKY_SIMD
+          int simdType = CoinMin(ClpCholeskySimdType(), ClpCholeskySimdMaximum);
+          if (simdType == 2) {
+               ClpCholeskyCrecRecFull8(above, aUnder, aOther, work);
+               return;
+          } else if (simdType == 1) {
+               ClpCholeskyCrecRecFull(above, aUnder, aOther, work);
+               return;
+          }
+#endif
 #ifdef INTEL
           aa += 2 * BLOCK;
           for (j = 0; j < BLOCK; j += 2) {
@@ -1231,10 +1759,53 @@ ClpCholeskyCrecRecLeaf(/*ClpCholeskyDenseC * thisStruct,*/
      }
 #endif
 }
+/* Refactorizes in double after refinement failed in solve */
+void
+ClpCholeskyDense::switchToDouble()
+{
+     singlePrecision_ = false;
+     delete [] floatFactor_;
+     floatFactor_ = NULL;
+     /* blocked matrix is untouched so start from same dropped rows*/
+     int * rowsDropped = floatRowsDropped_;
+     floatRowsDropped_ = NULL;
+     integerParameters_[20] = 0;
+     doubleParameters_[3] = 0.0;
+     doubleParameters_[4] = COIN_DBL_MAX;
+     factorizeDouble(rowsDropped);
+     diagonalStatistics();
+     choleskyCondition_ = doubleParameters_[3] / doubleParameters_[4];
+     /* same bookkeeping as factorize*/
+     int newDropped = 0;
+     for (int i = 0; i < numberRows_; i++) {
+          char dropped = static_cast<char>(rowsDropped[i]);
+          rowsDropped_[i] = dropped;
+          if (dropped == 2) {
+               /*dropped this time*/
+               newDropped++;
+               rowsDropped_[i] = 0;
+          }
+     }
+     numberRowsDropped_ = newDropped;
+     delete [] rowsDropped;
+}
 /* Uses factorization to solve. */
 void
 ClpCholeskyDense::solve (CoinWorkDouble * region)
 {
+     if (floatFactor_) {
+          CoinWorkDouble * save = CoinCopyOfArray(region, numberRows_);
+          bool converged = solveRefined(region);
+          if (converged) {
+               delete [] save;
+               return;
+          }
+          /* refinement failed - factorize in double from now on*/
+          COIN_DETAIL_PRINT(printf("Single precision refinement failed - going to double\n"));
+          switchToDouble();
+          CoinMemcpyN(save, numberRows_, region);
+          delete [] save;
+     }
 #ifdef CHOL_COMPARE
      double * region2 = NULL;
      if (numberRows_ < 200) {
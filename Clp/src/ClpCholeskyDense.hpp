@@ -58,6 +58,17 @@ public:
      inline longDouble * diagonal() const {
           return diagonal_;
      }
+     /** Single precision.  If set the blocked factorization is done in
+         float and each solve is refined in double against the original
+         matrix.  Switched off (and factorization redone in double) if
+         values are out of range for float, a pivot would be dropped or
+         refinement does not converge */
+     inline bool singlePrecision() const {
+          return singlePrecision_;
+     }
+     inline void setSinglePrecision(bool yesNo) {
+          singlePrecision_ = yesNo;
+     }
      /**@}*/
 
 
@@ -77,10 +88,35 @@ public:
 
 
 private:
+     /**@name Single precision factorization */
+     /**@{*/
+     /** Factorizes blocked matrix a into floatFactor_.
+         Returns false if out of range for float or refinement fails */
+     bool factorizeSingle(const longDouble * a, int numberBlocks, int * rowsDropped);
+     /// Solves using floatFactor_
+     void solveSingle(CoinWorkDouble * region) const;
+     /// region2 = original blocked matrix times region
+     void multiplyOriginal(const CoinWorkDouble * region, CoinWorkDouble * region2) const;
+     /// Solves using floatFactor_ and refinement - returns false if no convergence
+     bool solveRefined(CoinWorkDouble * region) const;
+     /// Factorizes blocked matrix in place in double
+     void factorizeDouble(int * rowsDropped);
+     /// Updates diagonal statistics after a blocked factorization
+     void diagonalStatistics();
+     /** Refactorizes in double after refinement failed in solve and
+         updates dropped rows as factorize does */
+     void switchToDouble();
+     /**@}*/
      /**@name Data members */
      /**@{*/
      /** Just borrowing space */
      bool borrowSpace_;
+     /// Factorize in single precision
+     bool singlePrecision_;
+     /// Single precision blocked factor (if last factorization was single)
+     float * floatFactor_;
+     /// Rows dropped going into single precision factorization
+     int * floatRowsDropped_;
      /**@}*/
 };
 
@@ -159,4 +195,9 @@ ClpCholeskyCrecRecLeaf(/*ClpCholeskyDenseC * thisStruct, */
      longDouble * COIN_RESTRICT aOther,
      const longDouble * COIN_RESTRICT work,
      int nUnder);
+/** Limits vector code used by ClpCholeskyCrecRecLeaf to maximumLevel
+    (0 scalar, 1 AVX2, 2 AVX-512 - the default) e.g. to compare against
+    scalar code.  Returns level which will be used on this machine */
+int
+ClpCholeskySetSimdLevel(int maximumLevel);
 #endif
@@ -17,6 +17,10 @@
 // at end to get min/max!
 #include "ClpDynamicMatrix.hpp"
 #include "ClpMessage.hpp"
+#if !defined(_MSC_VER) && !defined(CLP_NO_THREADS)
+#define CLP_DYNAMIC_THREADS
+#include <pthread.h>
+#endif
 //#define CLP_DEBUG
 //#define CLP_DEBUG_PRINT
 //#############################################################################
@@ -2362,13 +2366,16 @@ ClpDynamicMatrix::initialProblem()
        int numberRows = model_->numberRows();
        for (int i = numberActiveSets_; i < numberRows-numberStaticRows_; i++) {
 	 int iSequence = i + numberStaticRows_ + numberColumns;
-	 solution[iSequence] = 0.0;
-	 columnLower[iSequence] = -COIN_DBL_MAX;
-	 columnUpper[iSequence] = COIN_DBL_MAX;
-	 cost[iSequence] = 0.0;
-	 model_->nonLinearCost()->setOne(iSequence, solution[iSequence],
-					columnLower[iSequence],
-					columnUpper[iSequence], 0.0);
+	 // may be called from refresh before work arrays exist
+	 if (solution) {
+	   solution[iSequence] = 0.0;
+	   columnLower[iSequence] = -COIN_DBL_MAX;
+	   columnUpper[iSequence] = COIN_DBL_MAX;
+	   cost[iSequence] = 0.0;
+	   model_->nonLinearCost()->setOne(iSequence, solution[iSequence],
+					  columnLower[iSequence],
+					  columnUpper[iSequence], 0.0);
+	 }
 	 model_->setStatus(iSequence, ClpSimplex::basic);
 	 rhsOffset_[i+numberStaticRows_] = 0.0;
        }
@@ -2472,13 +2479,11 @@ ClpDynamicMatrix::writeMps(const char * name)
   delete [] row; 
   delete [] element;
 }
-// Adds in a column to gub structure (called from descendant)
+// Returns stored column of set iSet same as given one or -1
 int
-ClpDynamicMatrix::addColumn(int numberEntries, const int * row, const double * element,
-                            double cost, double lower, double upper, int iSet,
-                            DynamicStatus status)
+ClpDynamicMatrix::findColumn(int numberEntries, const int * row, const double * element,
+                             double cost, double lower, double upper, int iSet) const
 {
-     // check if already in
      int j = startSet_[iSet];
      while (j >= 0) {
           if (startColumn_[j+1] - startColumn_[j] == numberEntries) {
@@ -2505,13 +2510,26 @@ ClpDynamicMatrix::addColumn(int numberEntries, const int * row, const double * e
                                 columnLower_ ? columnLower_[j] : 0.0,
                                 columnUpper_ ? columnUpper_[j] : 1.0e100);
                     } else {
-		         setDynamicStatus(j, status);
                          return j;
-		    }
+                    }
                }
           }
           j = next_[j];
      }
+     return -1;
+}
+// Adds in a column to gub structure (called from descendant)
+int
+ClpDynamicMatrix::addColumn(int numberEntries, const int * row, const double * element,
+                            double cost, double lower, double upper, int iSet,
+                            DynamicStatus status)
+{
+     // check if already in
+     int j = findColumn(numberEntries, row, element, cost, lower, upper, iSet);
+     if (j >= 0) {
+          setDynamicStatus(j, status);
+          return j;
+     }
 
      if (numberGubColumns_ == maximumGubColumns_ ||
                startColumn_[numberGubColumns_] + numberEntries > maximumElements_) {
@@ -2603,3 +2621,386 @@ ClpDynamicMatrix::whichSet (int sequence) const
      int iSet = - next_[sequence] - 1;
      return iSet;
 }
+// Makes room in stored pool for at least this many columns and elements
+void
+ClpDynamicMatrix::resizePool(int numberColumns, CoinBigIndex numberElements)
+{
+     if (numberColumns > maximumGubColumns_) {
+          int oldMaximum = maximumGubColumns_;
+          int newMaximum = CoinMax(numberColumns, (3 * oldMaximum) / 2);
+          int * next = new int [newMaximum];
+          CoinMemcpyN(next_, numberGubColumns_, next);
+          delete [] next_;
+          next_ = next;
+          CoinBigIndex * startColumn = new CoinBigIndex [newMaximum+1];
+          CoinMemcpyN(startColumn_, numberGubColumns_ + 1, startColumn);
+          delete [] startColumn_;
+          startColumn_ = startColumn;
+          double * cost = new double [newMaximum];
+          CoinMemcpyN(cost_, numberGubColumns_, cost);
+          delete [] cost_;
+          cost_ = cost;
+          if (columnLower_) {
+               double * lower = new double [newMaximum];
+               CoinMemcpyN(columnLower_, numberGubColumns_, lower);
+               delete [] columnLower_;
+               columnLower_ = lower;
+          }
+          if (columnUpper_) {
+               double * upper = new double [newMaximum];
+               CoinMemcpyN(columnUpper_, numberGubColumns_, upper);
+               delete [] columnUpper_;
+               columnUpper_ = upper;
+          }
+          // second half is saved status
+          unsigned char * status = new unsigned char [2*newMaximum];
+          memset(status, 0, 2 * newMaximum);
+          CoinMemcpyN(dynamicStatus_, numberGubColumns_, status);
+          CoinMemcpyN(dynamicStatus_ + oldMaximum, numberGubColumns_, status + newMaximum);
+          delete [] dynamicStatus_;
+          dynamicStatus_ = status;
+          // slack keys are coded by maximum
+          for (int iSet = 0; iSet < numberSets_; iSet++) {
+               if (keyVariable_[iSet] >= oldMaximum)
+                    keyVariable_[iSet] += newMaximum - oldMaximum;
+          }
+          maximumGubColumns_ = newMaximum;
+     }
+     if (numberElements > maximumElements_) {
+          CoinBigIndex newMaximum = CoinMax(numberElements, (3 * maximumElements_) / 2);
+          CoinBigIndex n = startColumn_[numberGubColumns_];
+          int * row = new int [newMaximum];
+          CoinMemcpyN(row_, n, row);
+          delete [] row_;
+          row_ = row;
+          double * element = new double [newMaximum];
+          CoinMemcpyN(element_, n, element);
+          delete [] element_;
+          element_ = element;
+          maximumElements_ = newMaximum;
+     }
+}
+/* Adds columns to stored pool.  Columns come in at lower bound.
+   Returns number of columns stored */
+int
+ClpDynamicMatrix::addColumns(int number, const CoinBigIndex * starts, const int * row,
+                             const double * element, const double * cost,
+                             const double * lower, const double * upper, const int * set)
+{
+     if (number <= 0)
+          return 0;
+     int iColumn;
+     int maximumLength = 0;
+     for (iColumn = 0; iColumn < number; iColumn++)
+          maximumLength = CoinMax(maximumLength,
+                                  static_cast<int> (starts[iColumn+1] - starts[iColumn]));
+     resizePool(numberGubColumns_ + number,
+                startColumn_[numberGubColumns_] + starts[number] - starts[0]);
+     // create bound arrays if non default bounds
+     bool needLower = false;
+     bool needUpper = false;
+     for (iColumn = 0; iColumn < number; iColumn++) {
+          if (lower && lower[iColumn])
+               needLower = true;
+          if (upper && upper[iColumn] < 1.0e20)
+               needUpper = true;
+     }
+     if (needLower && !columnLower_) {
+          columnLower_ = new double [maximumGubColumns_];
+          CoinZeroN(columnLower_, maximumGubColumns_);
+     }
+     if (needUpper && !columnUpper_) {
+          columnUpper_ = new double [maximumGubColumns_];
+          CoinFillN(columnUpper_, maximumGubColumns_, COIN_DBL_MAX);
+     }
+     // stored columns are sorted
+     int * sortedRow = new int [maximumLength];
+     double * sortedElement = new double [maximumLength];
+     int numberAdded = 0;
+     for (iColumn = 0; iColumn < number; iColumn++) {
+          CoinBigIndex start = starts[iColumn];
+          int length = static_cast<int> (starts[iColumn+1] - start);
+          CoinMemcpyN(row + start, length, sortedRow);
+          CoinMemcpyN(element + start, length, sortedElement);
+          CoinSort_2(sortedRow, sortedRow + length, sortedElement);
+          double lowerValue = lower ? lower[iColumn] : 0.0;
+          double upperValue = upper ? upper[iColumn] : COIN_DBL_MAX;
+          if (!columnUpper_)
+               upperValue = COIN_DBL_MAX;
+          // leave status of a column already stored alone
+          if (findColumn(length, sortedRow, sortedElement, cost[iColumn],
+                         lowerValue, upperValue, set[iColumn]) >= 0)
+               continue;
+          addColumn(length, sortedRow, sortedElement, cost[iColumn],
+                    lowerValue, upperValue, set[iColumn], atLowerBound);
+          numberAdded++;
+     }
+     delete [] sortedRow;
+     delete [] sortedElement;
+     startSet_[numberSets_] = numberGubColumns_;
+     return numberAdded;
+}
+// Dual on convexity row of set
+double
+ClpDynamicMatrix::gubDual(const double * duals, int iSet) const
+{
+     double djMod = 0.0;
+     int gubRow = toIndex_[iSet];
+     if (gubRow >= 0) {
+          djMod = duals[gubRow+numberStaticRows_];
+     } else {
+          int iBasic = keyVariable_[iSet];
+          if (iBasic < maximumGubColumns_) {
+               // dj of key without set
+               for (CoinBigIndex j = startColumn_[iBasic];
+                         j < startColumn_[iBasic+1]; j++) {
+                    int jRow = row_[j];
+                    djMod -= duals[jRow] * element_[j];
+               }
+               djMod += cost_[iBasic];
+          }
+     }
+     return djMod;
+}
+// For threaded pricing of stored columns
+typedef struct {
+     const ClpDynamicMatrix * matrix;
+     const double * duals;
+     const double * djMod;
+     double * reducedCost;
+     double tolerance;
+     int startSet;
+     int endSet;
+     int numberImproving;
+} ClpDynamicPriceBlock;
+static void * clpDynamicPriceBlock(void * voidBlock)
+{
+     ClpDynamicPriceBlock * block = reinterpret_cast<ClpDynamicPriceBlock *> (voidBlock);
+     const ClpDynamicMatrix * matrix = block->matrix;
+     const int * startSet = matrix->startSets();
+     const int * next = matrix->next();
+     const CoinBigIndex * startColumn = matrix->startColumn();
+     const int * row = matrix->row();
+     const double * element = matrix->element();
+     const double * cost = matrix->cost();
+     const double * duals = block->duals;
+     double * reducedCost = block->reducedCost;
+     double tolerance = block->tolerance;
+     int numberImproving = 0;
+     for (int iSet = block->startSet; iSet < block->endSet; iSet++) {
+          double djMod = block->djMod[iSet];
+          int iSequence = startSet[iSet];
+          while (iSequence >= 0) {
+               ClpDynamicMatrix::DynamicStatus status = matrix->getDynamicStatus(iSequence);
+               double value = 0.0;
+               if (status == ClpDynamicMatrix::atLowerBound ||
+                         status == ClpDynamicMatrix::atUpperBound) {
+                    value = cost[iSequence] - djMod;
+                    for (CoinBigIndex j = startColumn[iSequence];
+                              j < startColumn[iSequence+1]; j++) {
+                         int jRow = row[j];
+                         value -= duals[jRow] * element[j];
+                    }
+                    if (!matrix->flagged(iSequence)) {
+                         if ((status == ClpDynamicMatrix::atLowerBound && value < -tolerance) ||
+                                   (status == ClpDynamicMatrix::atUpperBound && value > tolerance))
+                              numberImproving++;
+                    }
+               }
+               reducedCost[iSequence] = value;
+               iSequence = next[iSequence]; //onto next in set
+          }
+     }
+     block->numberImproving = numberImproving;
+     return NULL;
+}
+/* Computes reduced costs of stored columns at a bound using duals of
+   model.  Returns number of columns which would improve objective */
+int
+ClpDynamicMatrix::priceColumns(const ClpSimplex * model, double * reducedCost,
+                               int numberThreads) const
+{
+     if (!numberSets_)
+          return 0;
+     const double * duals = model->dualRowSolution();
+     double * djMod = new double [numberSets_];
+     for (int iSet = 0; iSet < numberSets_; iSet++)
+          djMod[iSet] = gubDual(duals, iSet);
+#ifndef CLP_DYNAMIC_THREADS
+     numberThreads = 1;
+#endif
+     numberThreads = CoinMax(1, CoinMin(numberThreads, numberSets_));
+     ClpDynamicPriceBlock * blocks = new ClpDynamicPriceBlock [numberThreads];
+     int start = 0;
+     for (int iThread = 0; iThread < numberThreads; iThread++) {
+          ClpDynamicPriceBlock & block = blocks[iThread];
+          block.matrix = this;
+          block.duals = duals;
+          block.djMod = djMod;
+          block.reducedCost = reducedCost;
+          block.tolerance = model->dualTolerance();
+          block.startSet = start;
+          block.endSet = (iThread < numberThreads - 1) ?
+                         start + numberSets_ / numberThreads : numberSets_;
+          block.numberImproving = 0;
+          start = block.endSet;
+     }
+#ifdef CLP_DYNAMIC_THREADS
+     if (numberThreads > 1) {
+          pthread_t * threadId = new pthread_t [numberThreads];
+          char * started = new char [numberThreads];
+          for (int iThread = 1; iThread < numberThreads; iThread++)
+               started[iThread] = pthread_create(threadId + iThread, NULL, clpDynamicPriceBlock,
+                                                 blocks + iThread) ? 0 : 1;
+          clpDynamicPriceBlock(blocks);
+          for (int iThread = 1; iThread < numberThreads; iThread++) {
+               if (started[iThread])
+                    pthread_join(threadId[iThread], NULL);
+               else
+                    clpDynamicPriceBlock(blocks + iThread);
+          }
+          delete [] started;
+          delete [] threadId;
+     } else {
+          clpDynamicPriceBlock(blocks);
+     }
+#else
+     clpDynamicPriceBlock(blocks);
+#endif
+     int numberImproving = 0;
+     for (int iThread = 0; iThread < numberThreads; iThread++)
+          numberImproving += blocks[iThread].numberImproving;
+     delete [] blocks;
+     delete [] djMod;
+     return numberImproving;
+}
+/* Removes stored columns at a zero lower bound whose reduced cost is
+   more than threshold.  Returns number removed */
+int
+ClpDynamicMatrix::purgeColumns(const ClpSimplex * model, double threshold,
+                               int numberThreads)
+{
+     int numberColumns = numberGubColumns_;
+     if (!numberSets_ || !numberColumns)
+          return 0;
+     double * reducedCost = new double [numberColumns];
+     priceColumns(model, reducedCost, numberThreads);
+     int * which = new int [numberColumns];
+     int iSet;
+     int i;
+     for (i = 0; i < numberColumns; i++) {
+          if (getDynamicStatus(i) == atLowerBound && !flagged(i) &&
+                    (!columnLower_ || !columnLower_[i]) &&
+                    reducedCost[i] > threshold)
+               which[i] = -1;
+          else
+               which[i] = 0;
+     }
+     delete [] reducedCost;
+     for (iSet = 0; iSet < numberSets_; iSet++) {
+          int key = keyVariable_[iSet];
+          if (key < maximumGubColumns_)
+               which[key] = 0;
+          // keep one in each set
+          int iSequence = startSet_[iSet];
+          bool any = false;
+          while (iSequence >= 0) {
+               if (!which[iSequence])
+                    any = true;
+               iSequence = next_[iSequence];
+          }
+          if (!any && startSet_[iSet] >= 0)
+               which[startSet_[iSet]] = 0;
+     }
+     // pack down
+     int put = 0;
+     CoinBigIndex numberElements = 0;
+     CoinBigIndex start = 0;
+     for (i = 0; i < numberColumns; i++) {
+          CoinBigIndex end = startColumn_[i+1];
+          if (!which[i]) {
+               for (CoinBigIndex j = start; j < end; j++) {
+                    row_[numberElements] = row_[j];
+                    element_[numberElements++] = element_[j];
+               }
+               startColumn_[put+1] = numberElements;
+               cost_[put] = cost_[i];
+               if (columnLower_)
+                    columnLower_[put] = columnLower_[i];
+               if (columnUpper_)
+                    columnUpper_[put] = columnUpper_[i];
+               dynamicStatus_[put] = dynamicStatus_[i];
+               which[i] = put;
+               put++;
+          }
+          start = end;
+     }
+     int numberRemoved = numberColumns - put;
+     if (numberRemoved) {
+          // redo startSet_ and next_ (keeping order)
+          int * newNext = new int [maximumGubColumns_];
+          for (iSet = 0; iSet < numberSets_; iSet++) {
+               int iSequence = startSet_[iSet];
+               int last = -1;
+               startSet_[iSet] = -1;
+               while (iSequence >= 0) {
+                    int newSequence = which[iSequence];
+                    if (newSequence >= 0) {
+                         if (last >= 0)
+                              newNext[last] = newSequence;
+                         else
+                              startSet_[iSet] = newSequence;
+                         last = newSequence;
+                    }
+                    iSequence = next_[iSequence];
+               }
+               if (last >= 0)
+                    newNext[last] = -iSet - 1;
+          }
+          delete [] next_;
+          next_ = newNext;
+          for (iSet = 0; iSet < numberSets_; iSet++) {
+               int key = keyVariable_[iSet];
+               if (key < maximumGubColumns_)
+                    keyVariable_[iSet] = which[key];
+          }
+          for (i = firstDynamic_; i < firstAvailable_; i++) {
+               int iBig = id_[i-firstDynamic_];
+               if (iBig >= 0)
+                    id_[i-firstDynamic_] = which[iBig];
+          }
+          numberGubColumns_ = put;
+          startSet_[numberSets_] = put;
+          savedBestSequence_ = -1;
+          // saved status no longer matches
+          CoinMemcpyN(dynamicStatus_, numberGubColumns_, dynamicStatus_ + maximumGubColumns_);
+          packDown(which, numberColumns);
+     }
+     delete [] which;
+     return numberRemoved;
+}
+// User pricing - this version adds no columns
+int
+ClpDynamicMatrix::generateColumns(ClpSimplex * )
+{
+     return 0;
+}
+/* Column generation loop.  Returns problem status of last solve */
+int
+ClpDynamicMatrix::columnGeneration(ClpSimplex * model, int maximumPasses,
+                                   double purgeThreshold, int numberThreads)
+{
+     int problemStatus = -1;
+     for (int iPass = 0; iPass < maximumPasses; iPass++) {
+          model->primal();
+          problemStatus = model->problemStatus();
+          if (problemStatus)
+               break;
+          int numberAdded = generateColumns(model);
+          if (!numberAdded)
+               break;
+          if (purgeThreshold >= 0.0)
+               purgeColumns(model, purgeThreshold, numberThreads);
+     }
+     return problemStatus;
+}
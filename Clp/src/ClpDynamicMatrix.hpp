@@ -102,11 +102,60 @@ public:
      int addColumn(int numberEntries, const int * row, const double * element,
                    double cost, double lower, double upper, int iSet,
                    DynamicStatus status);
+     /** Returns stored column of set iSet with same elements, cost and
+         bounds or -1 if none */
+     int findColumn(int numberEntries, const int * row, const double * element,
+                    double cost, double lower, double upper, int iSet) const;
      /** If addColumn forces compression then this allows descendant to know what to do.
          If >=0 then entry stayed in, if -1 then entry went out to lower bound.of zero.
          Entries at upper bound (really nonzero) never go out (at present).
      */
      virtual void packDown(const int * , int ) {}
+     //@}
+
+     /**@name Column generation
+        These are meant to be used between solves.  A user derives from this class
+        and overrides generateColumns, which is called after each solve and
+        puts any improving columns into stored pool with addColumns.
+        Descendants which keep their own arrays by stored column (as
+        ClpDynamicExampleMatrix does) should not use addColumns as pool may grow.
+     */
+     //@{
+     /** Adds columns to stored pool.  Columns come in at lower bound (which
+         should be zero).  lower and upper may be NULL for defaults of zero and
+         infinity.  set gives set of each column.  Pool grows as needed and
+         columns already stored are ignored (their status is left alone).
+         Returns number of columns stored */
+     int addColumns(int number, const CoinBigIndex * starts, const int * row,
+                    const double * element, const double * cost,
+                    const double * lower, const double * upper, const int * set);
+     /** Dual on convexity row of set iSet - reduced cost of a stored column is
+         cost minus this minus duals times elements */
+     double gubDual(const double * duals, int iSet) const;
+     /** Computes reduced costs of stored columns at a bound using duals of
+         model (entries for other columns are zero).  Sets are split over
+         numberThreads threads.  Returns number of columns which would improve
+         objective */
+     int priceColumns(const ClpSimplex * model, double * reducedCost,
+                      int numberThreads = 1) const;
+     /** Removes stored columns at a zero lower bound whose reduced cost is
+         more than threshold.  Keys, flagged columns and columns in small
+         problem are kept as is one column in each set.  packDown is called
+         so descendants know what happened.  Returns number removed */
+     int purgeColumns(const ClpSimplex * model, double threshold,
+                      int numberThreads = 1);
+     /** User pricing - called by columnGeneration after each optimal solve
+         with duals in model.  Should add improving columns with addColumns
+         and return number added.  This version adds none */
+     virtual int generateColumns(ClpSimplex * model);
+     /** Column generation loop - primal, then generateColumns and
+         purgeColumns until no columns added or maximumPasses done.
+         Negative purgeThreshold switches off purging.  As for any solve
+         with this matrix model should use partial pricing
+         (ClpPrimalColumnSteepest mode 5).
+         Returns problem status of last solve */
+     int columnGeneration(ClpSimplex * model, int maximumPasses = 100,
+                          double purgeThreshold = 1.0e3, int numberThreads = 1);
      /// Gets lower bound (to simplify coding)
      inline double columnLower(int sequence) const {
           if (columnLower_) return columnLower_[sequence];
@@ -209,6 +258,10 @@ public:
      inline double objectiveOffset() const {
           return objectiveOffset_;
      }
+     /// Next in set chain (-set-1 at end)
+     inline int * next() const {
+          return next_;
+     }
      /// Starts of each column
      inline CoinBigIndex * startColumn() const {
           return startColumn_;
@@ -286,8 +339,10 @@ public:
      int whichSet (int sequence) const;
      //@}
 
-
 protected:
+     /// Makes room in stored pool for at least this many columns and elements
+     void resizePool(int numberColumns, CoinBigIndex numberElements);
+
      /**@name Data members
         The data members are protected to allow access for derived classes. */
      //@{
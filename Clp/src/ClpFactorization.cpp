@@ -10,6 +10,7 @@
 #endif
 #include "CoinHelperFunctions.hpp"
 #include "CoinIndexedVector.hpp"
+#include "CoinTime.hpp"
 #include "ClpSimplex.hpp"
 #include "ClpSimplexDual.hpp"
 #include "ClpMatrixBase.hpp"
@@ -75,6 +76,8 @@ ClpFactorization::ClpFactorization () :
 #ifndef SLIM_CLP
      networkBasis_ = NULL;
 #endif
+     profile_ = NULL;
+     workCounter_ = NULL;
 }
 
 //-------------------------------------------------------------------
@@ -90,6 +93,8 @@ ClpFactorization::ClpFactorization (const ClpFactorization & rhs,
      else
           networkBasis_ = NULL;
 #endif
+     profile_ = NULL;
+     workCounter_ = NULL;
 }
 
 ClpFactorization::ClpFactorization (const CoinFactorization & rhs) :
@@ -98,6 +103,8 @@ ClpFactorization::ClpFactorization (const CoinFactorization & rhs) :
 #ifndef SLIM_CLP
      networkBasis_ = NULL;
 #endif
+     profile_ = NULL;
+     workCounter_ = NULL;
 }
 
 //-------------------------------------------------------------------
@@ -1138,6 +1145,8 @@ ClpFactorization::ClpFactorization ()
 #ifndef SLIM_CLP
      networkBasis_ = NULL;
 #endif
+     profile_ = NULL;
+     workCounter_ = NULL;
      //coinFactorizationA_ = NULL;
      coinFactorizationA_ = new CoinFactorization() ;
      coinFactorizationB_ = NULL;
@@ -1146,6 +1155,18 @@ ClpFactorization::ClpFactorization ()
      goOslThreshold_ = -1;
      goDenseThreshold_ = -1;
      goSmallThreshold_ = -1;
+     adaptiveRefactorization_ = 0;
+     costRatio_ = 1.0;
+     costRefactorize_ = false;
+     numberCostRefactorizations_ = 0;
+     costPivots_ = 0;
+     lastFactorizationTime_ = 0.0;
+     solveTime_ = 0.0;
+     lastPivotTime_ = 0.0;
+     lastPivotClock_ = 0.0;
+     recentPivotTime_ = 0.0;
+     totalFactorizationTime_ = 0.0;
+     totalSolveTime_ = 0.0;
 }
 
 //-------------------------------------------------------------------
@@ -1163,10 +1184,24 @@ ClpFactorization::ClpFactorization (const ClpFactorization & rhs,
      else
           networkBasis_ = NULL;
 #endif
+     profile_ = NULL;
+     workCounter_ = NULL;
      forceB_ = rhs.forceB_;
      goOslThreshold_ = rhs.goOslThreshold_;
      goDenseThreshold_ = rhs.goDenseThreshold_;
      goSmallThreshold_ = rhs.goSmallThreshold_;
+     adaptiveRefactorization_ = rhs.adaptiveRefactorization_;
+     costRatio_ = rhs.costRatio_;
+     costRefactorize_ = rhs.costRefactorize_;
+     numberCostRefactorizations_ = rhs.numberCostRefactorizations_;
+     costPivots_ = rhs.costPivots_;
+     lastFactorizationTime_ = rhs.lastFactorizationTime_;
+     solveTime_ = rhs.solveTime_;
+     lastPivotTime_ = rhs.lastPivotTime_;
+     lastPivotClock_ = rhs.lastPivotClock_;
+     recentPivotTime_ = rhs.recentPivotTime_;
+     totalFactorizationTime_ = rhs.totalFactorizationTime_;
+     totalSolveTime_ = rhs.totalSolveTime_;
      int goDense = 0;
 #ifdef CLP_REUSE_ETAS
      model_=rhs.model_;
@@ -1233,6 +1268,8 @@ ClpFactorization::ClpFactorization (const CoinFactorization & rhs)
 #ifndef SLIM_CLP
      networkBasis_ = NULL;
 #endif
+     profile_ = NULL;
+     workCounter_ = NULL;
      coinFactorizationA_ = new CoinFactorization(rhs);
      coinFactorizationB_ = NULL;
 #ifdef CLP_FACTORIZATION_INSTRUMENT
@@ -1242,6 +1279,18 @@ ClpFactorization::ClpFactorization (const CoinFactorization & rhs)
      goOslThreshold_ = -1;
      goDenseThreshold_ = -1;
      goSmallThreshold_ = -1;
+     adaptiveRefactorization_ = 0;
+     costRatio_ = 1.0;
+     costRefactorize_ = false;
+     numberCostRefactorizations_ = 0;
+     costPivots_ = 0;
+     lastFactorizationTime_ = 0.0;
+     solveTime_ = 0.0;
+     lastPivotTime_ = 0.0;
+     lastPivotClock_ = 0.0;
+     recentPivotTime_ = 0.0;
+     totalFactorizationTime_ = 0.0;
+     totalSolveTime_ = 0.0;
      assert (!coinFactorizationA_ || !coinFactorizationB_);
 }
 
@@ -1253,6 +1302,8 @@ ClpFactorization::ClpFactorization (const CoinOtherFactorization & rhs)
 #ifndef SLIM_CLP
      networkBasis_ = NULL;
 #endif
+     profile_ = NULL;
+     workCounter_ = NULL;
      coinFactorizationA_ = NULL;
      coinFactorizationB_ = rhs.clone();
      //coinFactorizationB_ = new CoinOtherFactorization(rhs);
@@ -1260,6 +1311,18 @@ ClpFactorization::ClpFactorization (const CoinOtherFactorization & rhs)
      goOslThreshold_ = -1;
      goDenseThreshold_ = -1;
      goSmallThreshold_ = -1;
+     adaptiveRefactorization_ = 0;
+     costRatio_ = 1.0;
+     costRefactorize_ = false;
+     numberCostRefactorizations_ = 0;
+     costPivots_ = 0;
+     lastFactorizationTime_ = 0.0;
+     solveTime_ = 0.0;
+     lastPivotTime_ = 0.0;
+     lastPivotClock_ = 0.0;
+     recentPivotTime_ = 0.0;
+     totalFactorizationTime_ = 0.0;
+     totalSolveTime_ = 0.0;
 #ifdef CLP_FACTORIZATION_INSTRUMENT
      factorization_instrument(1);
 #endif
@@ -1302,6 +1365,18 @@ ClpFactorization::operator=(const ClpFactorization& rhs)
           goOslThreshold_ = rhs.goOslThreshold_;
           goDenseThreshold_ = rhs.goDenseThreshold_;
           goSmallThreshold_ = rhs.goSmallThreshold_;
+          adaptiveRefactorization_ = rhs.adaptiveRefactorization_;
+          costRatio_ = rhs.costRatio_;
+          costRefactorize_ = rhs.costRefactorize_;
+          numberCostRefactorizations_ = rhs.numberCostRefactorizations_;
+          costPivots_ = rhs.costPivots_;
+          lastFactorizationTime_ = rhs.lastFactorizationTime_;
+          solveTime_ = rhs.solveTime_;
+          lastPivotTime_ = rhs.lastPivotTime_;
+          lastPivotClock_ = rhs.lastPivotClock_;
+          recentPivotTime_ = rhs.recentPivotTime_;
+          totalFactorizationTime_ = rhs.totalFactorizationTime_;
+          totalSolveTime_ = rhs.totalSolveTime_;
           if (rhs.coinFactorizationA_) {
                if (coinFactorizationA_)
                     *coinFactorizationA_ = *(rhs.coinFactorizationA_);
@@ -1403,10 +1478,29 @@ ClpFactorization::forceOtherFactorization(int which)
 	  goSmallThreshold_ = -1;
      }
 }
+// Switch on or off refactorization by measured cost
+void
+ClpFactorization::setAdaptiveRefactorization(int value)
+{
+     if (value && !adaptiveRefactorization_) {
+          numberCostRefactorizations_ = 0;
+          costPivots_ = 0;
+          lastFactorizationTime_ = 0.0;
+          solveTime_ = 0.0;
+          lastPivotTime_ = 0.0;
+          lastPivotClock_ = 0.0;
+          recentPivotTime_ = 0.0;
+          totalFactorizationTime_ = 0.0;
+          totalSolveTime_ = 0.0;
+     }
+     adaptiveRefactorization_ = value;
+     costRefactorize_ = false;
+}
 int
 ClpFactorization::factorize ( ClpSimplex * model,
                               int solveType, bool valuesPass)
 {
+     ClpProfileTimer timer(profile_, CLP_PROFILE_FACTORIZE);
 #ifdef CLP_REUSE_ETAS
      model_= model;
 #endif
@@ -1420,6 +1514,21 @@ ClpFactorization::factorize ( ClpSimplex * model,
 #ifdef CLP_FACTORIZATION_INSTRUMENT
      factorization_instrument(-1);
 #endif
+     double startTime = 0.0;
+     if (adaptiveRefactorization_) {
+          startTime = CoinGetTimeOfDay();
+          if (costRefactorize_) {
+               numberCostRefactorizations_++;
+               costPivots_ += pivots();
+          }
+          totalSolveTime_ += solveTime_;
+          solveTime_ = 0.0;
+          lastPivotTime_ = 0.0;
+          // if refactorizing during solve then charge everything since last pivot
+          if (solveType != 1 || !lastPivotClock_)
+               lastPivotClock_ = startTime;
+     }
+     costRefactorize_ = false;
      bool anyChanged = false;
      if (coinFactorizationB_) {
           coinFactorizationB_->setStatus(-99);
@@ -1749,6 +1858,11 @@ ClpFactorization::factorize ( ClpSimplex * model,
                static_cast<ClpSimplexDual *> (model)->changeBounds(3,
                          NULL, dummyCost);
           }
+          if (adaptiveRefactorization_) {
+               totalFactorizationTime_ += CoinGetTimeOfDay() - startTime;
+          }
+          if (workCounter_)
+               *workCounter_ += numberRows + coinFactorizationB_->numberElements();
           return coinFactorizationB_->status();
      }
      // If too many compressions increase area
@@ -2282,6 +2396,11 @@ ClpQuadraticObjective * quadraticObj = (static_cast< ClpQuadraticObjective*>(obj
 #ifdef CLP_FACTORIZATION_INSTRUMENT
      factorization_instrument(2);
 #endif
+     if (adaptiveRefactorization_) {
+          totalFactorizationTime_ += CoinGetTimeOfDay() - startTime;
+     }
+     if (workCounter_)
+          *workCounter_ += numberRows + coinFactorizationA_->numberElements();
      return coinFactorizationA_->status();
 }
 /* Replaces one Column in basis,
@@ -2300,12 +2419,15 @@ ClpFactorization::replaceColumn ( const ClpSimplex * model,
                                   bool checkBeforeModifying,
                                   double acceptablePivot)
 {
+     ClpProfileTimer timer(profile_, CLP_PROFILE_UPDATE);
 #ifndef SLIM_CLP
      if (!networkBasis_) {
 #endif
 #ifdef CLP_FACTORIZATION_INSTRUMENT
           factorization_instrument(-1);
 #endif
+          double startTime = adaptiveRefactorization_ ? CoinGetTimeOfDay() : 0.0;
+          CoinBigIndex numberInR = numberElementsR();
           int returnCode;
           // see if FT
           if (!coinFactorizationA_ || coinFactorizationA_->forrestTomlin()) {
@@ -2359,6 +2481,31 @@ ClpFactorization::replaceColumn ( const ClpSimplex * model,
                returnCode = coinFactorizationA_->replaceColumnPFI(tableauColumn,
                             pivotRow, pivotCheck); // Note array
           }
+          if (workCounter_)
+               *workCounter_ += 1 + numberElementsR() - numberInR;
+          if (adaptiveRefactorization_) {
+               double now = CoinGetTimeOfDay();
+               solveTime_ += now - startTime;
+               int numberPivots = pivots();
+               if (numberPivots <= 1) {
+                    // all work since last pivot of previous cycle is cost of refactorizing
+                    lastFactorizationTime_ = now - lastPivotClock_;
+                    totalSolveTime_ += solveTime_;
+                    solveTime_ = 0.0;
+               } else {
+                    double pivotTime = solveTime_ - lastPivotTime_;
+                    if (numberPivots == 2)
+                         recentPivotTime_ = pivotTime;
+                    else
+                         recentPivotTime_ += 0.25 * (pivotTime - recentPivotTime_);
+                    // refactorize once next pivot costs more than average so far
+                    if (numberPivots >= 10 && recentPivotTime_ * (numberPivots - 1) >
+                              costRatio_ * (lastFactorizationTime_ + solveTime_))
+                         costRefactorize_ = true;
+               }
+               lastPivotTime_ = solveTime_;
+               lastPivotClock_ = now;
+          }
 #ifdef CLP_FACTORIZATION_INSTRUMENT
           factorization_instrument(3);
 #endif
@@ -2392,6 +2539,7 @@ int
 ClpFactorization::updateColumnFT ( CoinIndexedVector * regionSparse,
                                    CoinIndexedVector * regionSparse2)
 {
+     ClpProfileTimer timer(profile_, CLP_PROFILE_FTRAN);
 #ifdef CLP_DEBUG
      regionSparse->checkClear();
 #endif
@@ -2403,6 +2551,8 @@ ClpFactorization::updateColumnFT ( CoinIndexedVector * regionSparse,
 #ifdef CLP_FACTORIZATION_INSTRUMENT
           factorization_instrument(-1);
 #endif
+          double startTime = adaptiveRefactorization_ ? CoinGetTimeOfDay() : 0.0;
+          int numberIn = regionSparse2->getNumElements();
           int returnCode;
           if (coinFactorizationA_) {
                coinFactorizationA_->setCollectStatistics(true);
@@ -2419,6 +2569,10 @@ ClpFactorization::updateColumnFT ( CoinIndexedVector * regionSparse,
 	      returnCode = coinFactorizationB_->updateColumnFT(regionSparse,
                             regionSparse2);
           }
+          if (workCounter_)
+               *workCounter_ += numberIn + regionSparse2->getNumElements();
+          if (adaptiveRefactorization_)
+               solveTime_ += CoinGetTimeOfDay() - startTime;
 #ifdef CLP_FACTORIZATION_INSTRUMENT
           factorization_instrument(4);
 #endif
@@ -2474,6 +2628,7 @@ ClpFactorization::updateColumn ( CoinIndexedVector * regionSparse,
                                  CoinIndexedVector * regionSparse2,
                                  bool noPermute) const
 {
+     ClpProfileTimer timer(profile_, CLP_PROFILE_FTRAN);
 #ifdef CLP_DEBUG
      if (!noPermute)
           regionSparse->checkClear();
@@ -2486,6 +2641,8 @@ ClpFactorization::updateColumn ( CoinIndexedVector * regionSparse,
 #ifdef CLP_FACTORIZATION_INSTRUMENT
           factorization_instrument(-1);
 #endif
+          double startTime = adaptiveRefactorization_ ? CoinGetTimeOfDay() : 0.0;
+          int numberIn = regionSparse2->getNumElements();
           int returnCode;
           if (coinFactorizationA_) {
                coinFactorizationA_->setCollectStatistics(true);
@@ -2498,6 +2655,10 @@ ClpFactorization::updateColumn ( CoinIndexedVector * regionSparse,
                             regionSparse2,
                             noPermute);
           }
+          if (workCounter_)
+               *workCounter_ += numberIn + regionSparse2->getNumElements();
+          if (adaptiveRefactorization_)
+               solveTime_ += CoinGetTimeOfDay() - startTime;
 #ifdef CLP_FACTORIZATION_INSTRUMENT
           factorization_instrument(5);
 #endif
@@ -2562,6 +2723,7 @@ ClpFactorization::updateTwoColumnsFT ( CoinIndexedVector * regionSparse1,
                                        CoinIndexedVector * regionSparse3,
                                        bool noPermuteRegion3)
 {
+     ClpProfileTimer timer(profile_, CLP_PROFILE_FTRAN);
 #ifdef CLP_DEBUG
      regionSparse1->checkClear();
 #endif
@@ -2574,6 +2736,8 @@ ClpFactorization::updateTwoColumnsFT ( CoinIndexedVector * regionSparse1,
 #ifdef CLP_FACTORIZATION_INSTRUMENT
           factorization_instrument(-1);
 #endif
+          double startTime = adaptiveRefactorization_ ? CoinGetTimeOfDay() : 0.0;
+          int numberIn = regionSparse2->getNumElements() + regionSparse3->getNumElements();
           if (coinFactorizationA_) {
                coinFactorizationA_->setCollectStatistics(true);
                if (coinFactorizationA_->spaceForForrestTomlin()) {
@@ -2622,6 +2786,11 @@ ClpFactorization::updateTwoColumnsFT ( CoinIndexedVector * regionSparse1,
 							      noPermuteRegion3);
 #endif
           }
+          if (workCounter_)
+               *workCounter_ += numberIn + regionSparse2->getNumElements() +
+                                regionSparse3->getNumElements();
+          if (adaptiveRefactorization_)
+               solveTime_ += CoinGetTimeOfDay() - startTime;
 #ifdef CLP_FACTORIZATION_INSTRUMENT
           factorization_instrument(9);
 #endif
@@ -2663,6 +2832,7 @@ int
 ClpFactorization::updateColumnTranspose ( CoinIndexedVector * regionSparse,
           CoinIndexedVector * regionSparse2) const
 {
+     ClpProfileTimer timer(profile_, CLP_PROFILE_BTRAN);
      if (!numberRows())
           return 0;
 #ifndef SLIM_CLP
@@ -2671,6 +2841,8 @@ ClpFactorization::updateColumnTranspose ( CoinIndexedVector * regionSparse,
 #ifdef CLP_FACTORIZATION_INSTRUMENT
           factorization_instrument(-1);
 #endif
+          double startTime = adaptiveRefactorization_ ? CoinGetTimeOfDay() : 0.0;
+          int numberIn = regionSparse2->getNumElements();
           int returnCode;
 
           if (coinFactorizationA_) {
@@ -2682,6 +2854,10 @@ ClpFactorization::updateColumnTranspose ( CoinIndexedVector * regionSparse,
                returnCode = coinFactorizationB_->updateColumnTranspose(regionSparse,
                             regionSparse2);
           }
+          if (workCounter_)
+               *workCounter_ += numberIn + regionSparse2->getNumElements();
+          if (adaptiveRefactorization_)
+               solveTime_ += CoinGetTimeOfDay() - startTime;
 #ifdef CLP_FACTORIZATION_INSTRUMENT
           factorization_instrument(6);
 #endif
@@ -13,6 +13,7 @@
 class ClpMatrixBase;
 class ClpSimplex;
 class ClpNetworkBasis;
+class ClpSimplexProfile;
 class CoinOtherFactorization;
 #ifndef CLP_MULTIPLE_FACTORIZATIONS
 #define CLP_MULTIPLE_FACTORIZATIONS 4
@@ -204,6 +205,16 @@ public:
           if (coinFactorizationA_) return coinFactorizationA_->numberDense();
           else return 0 ;
      }
+     /// Returns number of singleton pivots after slacks before bump
+     inline int numberTriangular() const {
+          if (coinFactorizationA_) return coinFactorizationA_->numberTriangular();
+          else return 0 ;
+     }
+     /// Returns size of bump (rows not slack or triangular)
+     inline int bumpSize() const {
+          if (coinFactorizationA_) return coinFactorizationA_->bumpSize();
+          else return 0 ;
+     }
 #if 1
      /// Returns number in U area
      inline CoinBigIndex numberElementsU (  ) const {
@@ -222,6 +233,8 @@ public:
      }
 #endif
      inline bool timeToRefactorize() const {
+          if (costRefactorize_)
+               return true;
           if (coinFactorizationA_) {
                return (coinFactorizationA_->pivots() * 3 > coinFactorizationA_->maximumPivots() * 2 &&
                        coinFactorizationA_->numberElementsR() * 3 > (coinFactorizationA_->numberElementsL() +
@@ -351,6 +364,45 @@ public:
      inline int isDenseOrSmall() const {
           return coinFactorizationB_ ? 1 : 0;
      }
+     /** Adaptive refactorization.
+         0 - off (refactorize on pivot count and size of R only)
+         1 - also time solves and say time to refactorize once the smoothed
+         solve cost of a pivot exceeds the average cost per pivot since the
+         last factorization (see costRatio()).  The cost of refactorizing is taken as all time
+         from the last pivot before it to the first pivot after it.
+         maximumPivots is still an upper limit.  Decisions depend on timing
+         so runs are not repeatable when this is on.
+     */
+     inline int adaptiveRefactorization() const {
+          return adaptiveRefactorization_;
+     }
+     void setAdaptiveRefactorization(int value);
+     /** When adaptive, refactorize once smoothed solve cost of a pivot times
+         pivots exceeds this times cost so far (default 1.0).  Smaller
+         values refactorize sooner */
+     inline double costRatio() const {
+          return costRatio_;
+     }
+     inline void setCostRatio(double value) {
+          costRatio_ = value;
+     }
+     /// Number of refactorizations asked for by measured cost
+     inline int numberCostRefactorizations() const {
+          return numberCostRefactorizations_;
+     }
+     /// Average number of pivots at which measured cost asked for refactorization
+     inline double averageCostPivots() const {
+          return numberCostRefactorizations_ ?
+                 static_cast<double>(costPivots_) / numberCostRefactorizations_ : 0.0;
+     }
+     /// Elapsed time in factorizations (when adaptive)
+     inline double factorizationTime() const {
+          return totalFactorizationTime_;
+     }
+     /// Elapsed time in solves and updates (when adaptive)
+     inline double solveTime() const {
+          return totalSolveTime_ + solveTime_;
+     }
 #else
      inline bool timeToRefactorize() const {
           return (pivots() * 3 > maximumPivots() * 2 &&
@@ -391,6 +443,14 @@ public:
 #endif
      /// Fills weighted row list
      void getWeights(int * weights) const;
+     /// Sets profile to time factorize, solves and updates in (NULL for none)
+     inline void setProfile(ClpSimplexProfile * profile) {
+          profile_ = profile;
+     }
+     /// Sets counter to add deterministic work to (NULL for none)
+     inline void setWorkCounter(double * counter) {
+          workCounter_ = counter;
+     }
      //@}
 
 ////////////////// data //////////////////
@@ -402,6 +462,10 @@ private:
 #ifndef SLIM_CLP
      ClpNetworkBasis * networkBasis_;
 #endif
+     /// Profile of owning model (not owned)
+     ClpSimplexProfile * profile_;
+     /// Work counter of owning model (not owned)
+     double * workCounter_;
 #ifdef CLP_MULTIPLE_FACTORIZATIONS
      /// Pointer to CoinFactorization
      CoinFactorization * coinFactorizationA_;
@@ -419,6 +483,30 @@ private:
      int goSmallThreshold_;
      /// Switch to dense if number rows <= this
      int goDenseThreshold_;
+     /// Adaptive refactorization (see adaptiveRefactorization())
+     int adaptiveRefactorization_;
+     /// Refactorize sooner (<1.0) or later on measured cost
+     double costRatio_;
+     /// True if measured cost says refactorize now
+     bool costRefactorize_;
+     /// Number of refactorizations asked for by measured cost
+     int numberCostRefactorizations_;
+     /// Total pivots at which measured cost asked for refactorization
+     int costPivots_;
+     /// Cost of last refactorization (from last pivot before to first pivot after)
+     double lastFactorizationTime_;
+     /// Time in solves since last factorization
+     mutable double solveTime_;
+     /// Value of solveTime_ at last pivot
+     double lastPivotTime_;
+     /// Clock at last pivot (or start of factorization)
+     double lastPivotClock_;
+     /// Smoothed solve time per pivot
+     double recentPivotTime_;
+     /// Total time in factorizations
+     double totalFactorizationTime_;
+     /// Total time in solves before last factorization
+     double totalSolveTime_;
 #endif
      //@}
 };
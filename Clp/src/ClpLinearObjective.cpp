@@ -36,6 +36,15 @@ ClpLinearObjective::ClpLinearObjective (const double * objective ,
      numberColumns_ = numberColumns;
      objective_ = CoinCopyOfArray(objective, numberColumns_, 0.0);
 }
+// Takes over objective
+void
+ClpLinearObjective::assignObjective(double *& objective, int numberColumns)
+{
+     delete [] objective_;
+     numberColumns_ = numberColumns;
+     objective_ = objective;
+     objective = NULL;
+}
 
 //-------------------------------------------------------------------
 // Copy constructor
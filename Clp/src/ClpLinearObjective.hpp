@@ -64,6 +64,9 @@ public:
 
      /// Constructor from objective
      ClpLinearObjective(const double * objective, int numberColumns);
+     /** Takes over objective (which must have been created with new [])
+         instead of copying it.  objective is set to NULL */
+     void assignObjective(double *& objective, int numberColumns);
 
      /// Copy constructor
      ClpLinearObjective(const ClpLinearObjective &);
@@ -737,6 +737,9 @@ main (int argc, const char *argv[])
                               case CLP_PARAM_STR_ABCWANTED:
                                    models[iModel].setAbcState(action);
                                    break;
+                              case CLP_PARAM_STR_PROFILE:
+                                   models[iModel].setProfiling(action != 0);
+                                   break;
                               case CLP_PARAM_STR_INTPRINT:
                                    printMode = action;
                                    break;
@@ -997,6 +1000,8 @@ main (int argc, const char *argv[])
                                              solveOptions.setSpecialOption(1, 11); // switch off values
                                    } else if (method == ClpSolve::useBarrier || method == ClpSolve::useBarrierNoCross) {
                                         int barrierOptions = choleskyType;
+                                        if (choleskyType == 7)
+                                             barrierOptions = 1 | 8192; // dense in single precision
                                         if (scaleBarrier) {
                                              if ((scaleBarrier & 1) != 0)
                                                   barrierOptions |= 8;
@@ -1034,6 +1039,10 @@ main (int argc, const char *argv[])
 				     model2->factorization()->setGoSmallThreshold(smallCode);
                                    model2->factorization()->goDenseOrSmall(model2->numberRows());
 #endif
+                                   // time phases of iterations if asked for
+                                   if (models[iModel].profile())
+                                        model2->setProfiling(true);
+                                   model2->clearProfile();
                                    try {
                                         status = model2->initialSolve(solveOptions);
 #ifdef COIN_HAS_ASL
@@ -1211,6 +1220,20 @@ main (int argc, const char *argv[])
                                         e.print();
                                         status = -1;
                                    }
+                                   if (model2->profile()) {
+                                        const ClpSimplexProfile * profile = model2->profile();
+                                        char line[200];
+                                        for (int iPhase = 0; iPhase < CLP_PROFILE_NUMBER; iPhase++) {
+                                             int count = profile->count[iPhase];
+                                             double time = profile->time[iPhase];
+                                             sprintf(line, "%s %.3f seconds, %d calls, %.2f microseconds per call",
+                                                     ClpSimplexProfile::phaseName(iPhase), time, count,
+                                                     count ? 1.0e6 * time / count : 0.0);
+                                             model2->messageHandler()->message(CLP_GENERAL, model2->messages())
+                                                       << line
+                                                       << CoinMessageEol;
+                                        }
+                                   }
                                    if (dualize) {
 				     ClpSimplex * thisModel=models+iModel;
                                         int returnCode = static_cast<ClpSimplexOther *> (thisModel)->restoreFromDual(model2);
@@ -1740,7 +1763,11 @@ main (int argc, const char *argv[])
                                    }
                                    if (canOpen) {
                                         ClpSimplex * model2 = models + iModel;
-                                        model2->writeBasis(fileName.c_str(), outputFormat > 1, outputFormat - 2);
+                                        if (fileName.size() > 4 &&
+                                                  fileName.substr(fileName.size() - 4) == ".bin")
+                                             model2->writeBinaryBasis(fileName.c_str());
+                                        else
+                                             model2->writeBasis(fileName.c_str(), outputFormat > 1, outputFormat - 2);
                                         time2 = CoinCpuTime();
                                         totalTime += time2 - time1;
                                         time1 = time2;
@@ -2114,6 +2141,62 @@ main (int argc, const char *argv[])
 			      // }
                               mainTest(nFields, fields, algorithm, *models,
                                        solveOptions, 0, doVector != 0);
+#endif
+                         }
+                         break;
+                         case CLP_PARAM_ACTION_BASELINE: {
+                              std::string name = CoinReadGetString(argc, argv);
+                              if (name != "EOL")
+                                   parameters[iParam].setStringValue(name);
+                              else
+                                   parameters[iParam].printString();
+                         }
+                         break;
+                         case CLP_PARAM_ACTION_BENCHMARK: {
+                              std::string name = CoinReadGetString(argc, argv);
+                              if (name == "$") {
+                                   name = parameters[iParam].stringValue();
+                              } else if (name == "EOL") {
+                                   parameters[iParam].printString();
+                                   break;
+                              } else {
+                                   parameters[iParam].setStringValue(name);
+                              }
+                              // create fields for unitTest
+                              const char * fields[6];
+                              int nFields = 5;
+                              fields[0] = "fake main from unitTest";
+                              std::string mpsfield = "-dirSample=";
+                              mpsfield += dirSample.c_str();
+                              fields[1] = mpsfield.c_str();
+                              std::string netfield = "-dirNetlib=";
+                              netfield += dirNetlib.c_str();
+                              fields[2] = netfield.c_str();
+                              std::string benchmarkField = "-benchmark=";
+                              benchmarkField += name;
+                              fields[3] = benchmarkField.c_str();
+                              char runsField[40];
+                              sprintf(runsField, "-benchmarkRuns=%d",
+                                      parameters[whichParam(CLP_PARAM_INT_BENCHMARKRUNS, numberParameters, parameters)].intValue());
+                              fields[4] = runsField;
+                              std::string baselineField = "-baseline=";
+                              baselineField += parameters[whichParam(CLP_PARAM_ACTION_BASELINE, numberParameters, parameters)].stringValue();
+                              if (baselineField != "-baseline=")
+                                   fields[nFields++] = baselineField.c_str();
+                              models[iModel].setSpecialOptions(0);
+                              ClpSolve solveOptions;
+                              ClpSolve::PresolveType presolveType;
+                              if (preSolve)
+                                   presolveType = ClpSolve::presolveOn;
+                              else
+                                   presolveType = ClpSolve::presolveOff;
+                              solveOptions.setPresolveType(presolveType, 5);
+#ifndef ABC_INHERIT
+                              mainTest(nFields, fields, 6, *thisModel,
+                                       solveOptions, 0, doVector != 0);
+#else
+                              mainTest(nFields, fields, 6, *models,
+                                       solveOptions, 0, doVector != 0);
 #endif
                          }
                          break;
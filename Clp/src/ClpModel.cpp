@@ -73,6 +73,8 @@ ClpModel::ClpModel (bool emptyMessages) :
      smallElement_(1.0e-20),
      objectiveScale_(1.0),
      rhsScale_(1.0),
+     workUnits_(0.0),
+     maximumWorkUnits_(-1.0),
      numberRows_(0),
      numberColumns_(0),
      rowActivity_(NULL),
@@ -110,6 +112,7 @@ ClpModel::ClpModel (bool emptyMessages) :
      defaultHandler_(true),
      rowNames_(),
      columnNames_(),
+     nameHashing_(false),
 #else
      defaultHandler_(true),
 #endif
@@ -134,6 +137,11 @@ ClpModel::ClpModel (bool emptyMessages) :
 
 #ifndef CLP_NO_STD
      strParam_[ClpProbName] = "ClpDefaultName";
+     for (int i = 0; i < 2; i++) {
+          nameHash_[i] = NULL;
+          nameHashSize_[i] = 0;
+          nameHashCount_[i] = 0;
+     }
 #endif
      handler_ = new CoinMessageHandler();
      handler_->setLogLevel(1);
@@ -211,6 +219,9 @@ ClpModel::gutsOfDelete(int type)
      delete [] ray_;
      ray_ = NULL;
      specialOptions_ = 0;
+#ifndef CLP_NO_STD
+     deleteNameHash();
+#endif
 }
 void
 ClpModel::setRowScale(double * scale)
@@ -255,6 +266,21 @@ ClpModel::gutsOfLoadModel (int numberRows, int numberColumns,
                            const double* obj,
                            const double* rowlb, const double* rowub,
                            const double * rowObjective)
+{
+     startLoadModel(numberRows, numberColumns);
+     rowLower_ = ClpCopyOfArray(rowlb, numberRows_, -COIN_DBL_MAX);
+     rowUpper_ = ClpCopyOfArray(rowub, numberRows_, COIN_DBL_MAX);
+     double * objective = ClpCopyOfArray(obj, numberColumns_, 0.0);
+     objective_ = new ClpLinearObjective(objective, numberColumns_);
+     delete [] objective;
+     rowObjective_ = ClpCopyOfArray(rowObjective, numberRows_);
+     columnLower_ = ClpCopyOfArray(collb, numberColumns_, 0.0);
+     columnUpper_ = ClpCopyOfArray(colub, numberColumns_, COIN_DBL_MAX);
+     finishLoadModel();
+}
+// Start of loading - deletes old model and creates solution arrays
+void
+ClpModel::startLoadModel(int numberRows, int numberColumns)
 {
      // save event handler in case already set
      ClpEventHandler * handler = eventHandler_->clone();
@@ -272,16 +298,12 @@ ClpModel::gutsOfLoadModel (int numberRows, int numberColumns,
 
      CoinZeroN(dual_, numberRows_);
      CoinZeroN(reducedCost_, numberColumns_);
+}
+// End of loading - cleans bounds and sets default solution
+void
+ClpModel::finishLoadModel()
+{
      int iRow, iColumn;
-
-     rowLower_ = ClpCopyOfArray(rowlb, numberRows_, -COIN_DBL_MAX);
-     rowUpper_ = ClpCopyOfArray(rowub, numberRows_, COIN_DBL_MAX);
-     double * objective = ClpCopyOfArray(obj, numberColumns_, 0.0);
-     objective_ = new ClpLinearObjective(objective, numberColumns_);
-     delete [] objective;
-     rowObjective_ = ClpCopyOfArray(rowObjective, numberRows_);
-     columnLower_ = ClpCopyOfArray(collb, numberColumns_, 0.0);
-     columnUpper_ = ClpCopyOfArray(colub, numberColumns_, COIN_DBL_MAX);
      // set default solution and clean bounds
      for (iRow = 0; iRow < numberRows_; iRow++) {
           if (rowLower_[iRow] > 0.0) {
@@ -405,6 +427,42 @@ ClpModel::loadProblem (
                              value, index, start, length);
      matrix_ = new ClpPackedMatrix(matrix);
 }
+// Loads a problem by taking over the arguments
+void
+ClpModel::assignProblem (  CoinPackedMatrix *& matrix,
+                           double *& collb, double *& colub, double *& obj,
+                           double *& rowlb, double *& rowub)
+{
+     ClpPackedMatrix* clpMatrix =
+          dynamic_cast< ClpPackedMatrix*>(matrix_);
+     bool special = (clpMatrix) ? clpMatrix->wantsSpecialColumnCopy() : false;
+     int numberRows = matrix->getNumRows();
+     int numberColumns = matrix->getNumCols();
+     startLoadModel(numberRows, numberColumns);
+     rowLower_ = rowlb ? rowlb : ClpCopyOfArray(rowlb, numberRows_, -COIN_DBL_MAX);
+     rowUpper_ = rowub ? rowub : ClpCopyOfArray(rowub, numberRows_, COIN_DBL_MAX);
+     columnLower_ = collb ? collb : ClpCopyOfArray(collb, numberColumns_, 0.0);
+     columnUpper_ = colub ? colub : ClpCopyOfArray(colub, numberColumns_, COIN_DBL_MAX);
+     if (!obj)
+          obj = ClpCopyOfArray(obj, numberColumns_, 0.0);
+     ClpLinearObjective * objective = new ClpLinearObjective();
+     objective->assignObjective(obj, numberColumns_);
+     objective_ = objective;
+     rowlb = NULL;
+     rowub = NULL;
+     collb = NULL;
+     colub = NULL;
+     finishLoadModel();
+     if (!matrix->isColOrdered())
+          matrix->reverseOrdering();
+     matrix_ = new ClpPackedMatrix(matrix);
+     matrix = NULL;
+     if (special) {
+          clpMatrix = static_cast< ClpPackedMatrix*>(matrix_);
+          clpMatrix->makeSpecialColumnCopy();
+     }
+     matrix_->setDimensions(numberRows_, numberColumns_);
+}
 #ifndef SLIM_NOIO
 // This loads a model from a coinModel object - returns number of errors
 int
@@ -687,6 +745,9 @@ ClpModel::ClpModel(const ClpModel &rhs, int scalingMode) :
      numberRows_(rhs.numberRows_),
      numberColumns_(rhs.numberColumns_),
      specialOptions_(rhs.specialOptions_),
+#ifndef CLP_NO_STD
+     nameHashing_(false),
+#endif
      maximumColumns_(-1),
      maximumRows_(-1),
      maximumInternalColumns_(-1),
@@ -694,6 +755,13 @@ ClpModel::ClpModel(const ClpModel &rhs, int scalingMode) :
      savedRowScale_(NULL),
      savedColumnScale_(NULL)
 {
+#ifndef CLP_NO_STD
+     for (int i = 0; i < 2; i++) {
+          nameHash_[i] = NULL;
+          nameHashSize_[i] = 0;
+          nameHashCount_[i] = 0;
+     }
+#endif
      gutsOfCopy(rhs);
      if (scalingMode >= 0 && matrix_ &&
                matrix_->allElementsInRange(this, smallElement_, 1.0e20)) {
@@ -768,6 +836,8 @@ ClpModel::gutsOfCopy(const ClpModel & rhs, int trueCopy)
      dblParam_[ClpObjOffset] = rhs.dblParam_[ClpObjOffset];
      dblParam_[ClpMaxSeconds] = rhs.dblParam_[ClpMaxSeconds];
      dblParam_[ClpPresolveTolerance] = rhs.dblParam_[ClpPresolveTolerance];
+     workUnits_ = rhs.workUnits_;
+     maximumWorkUnits_ = rhs.maximumWorkUnits_;
 #ifndef CLP_NO_STD
 
      strParam_[ClpProbName] = rhs.strParam_[ClpProbName];
@@ -789,6 +859,10 @@ ClpModel::gutsOfCopy(const ClpModel & rhs, int trueCopy)
      trustedUserPointer_ = rhs.trustedUserPointer_;
      scalingFlag_ = rhs.scalingFlag_;
      specialOptions_ = rhs.specialOptions_;
+#ifndef CLP_NO_STD
+     deleteNameHash();
+     nameHashing_ = rhs.nameHashing_;
+#endif
      if (trueCopy) {
 #ifndef CLP_NO_STD
           lengthNames_ = rhs.lengthNames_;
@@ -1217,6 +1291,42 @@ char * deleteChar(char * array , int size,
      }
      return array;
 }
+/* Scale arrays hold size scale factors followed by size inverses.
+   Keeps both halves for survivors so scaling need not be redone. */
+double * deleteScale(double * array , int size,
+                     int number, const int * which, int & newSize)
+{
+     if (array) {
+          int i ;
+          char * deleted = new char[size];
+          int numberDeleted = 0;
+          CoinZeroN(deleted, size);
+          for (i = 0; i < number; i++) {
+               int j = which[i];
+               if (j >= 0 && j < size && !deleted[j]) {
+                    numberDeleted++;
+                    deleted[j] = 1;
+               }
+          }
+          newSize = size - numberDeleted;
+          double * newArray = NULL;
+          if (newSize) {
+               newArray = new double[2*newSize];
+               int put = 0;
+               for (i = 0; i < size; i++) {
+                    if (!deleted[i]) {
+                         newArray[put] = array[i];
+                         newArray[put+newSize] = array[i+size];
+                         put++;
+                    }
+               }
+          }
+          delete [] array;
+          array = newArray;
+          delete [] deleted;
+     }
+     return array;
+}
 // Create empty ClpPackedMatrix
 void
 ClpModel::createEmptyMatrix()
@@ -1350,6 +1460,8 @@ ClpModel::resize (int newNumberRows, int newNumberColumns)
           }
      }
 #ifndef CLP_NO_STD
+     if (newNumberRows < numberRows_ || newNumberColumns < numberColumns_)
+          deleteNameHash();
      if (lengthNames_) {
           // redo row and column names
           if (numberRows_ < newNumberRows) {
@@ -1409,6 +1521,7 @@ ClpModel::deleteRows(int number, const int * which)
           return; // nothing to do
      whatsChanged_ &= ~(1 + 2 + 4 + 8 + 16 + 32); // all except columns changed
      int newSize = 0;
+     bool keepScale = false;
      if (maximumRows_ < 0) {
           rowActivity_ = deleteDouble(rowActivity_, numberRows_,
                                       number, which, newSize);
@@ -1423,6 +1536,18 @@ ClpModel::deleteRows(int number, const int * which)
           if (matrix_->getNumRows())
                matrix_->deleteRows(number, which);
           //matrix_->removeGaps();
+          // keep scale factors of surviving rows (columns unchanged)
+          if (rowScale_ && rowScale_ != savedRowScale_ && matrix_->type() == 1) {
+               int newSize2 = 0;
+               rowScale_ = deleteScale(rowScale_, numberRows_,
+                                       number, which, newSize2);
+               keepScale = (rowScale_ != NULL);
+               if (!keepScale) {
+                    // no rows left - row scales have gone so drop column scales
+                    delete [] columnScale_;
+                    columnScale_ = NULL;
+               }
+          }
           // status
           if (status_) {
                if (numberColumns_ + newSize) {
@@ -1472,6 +1597,7 @@ ClpModel::deleteRows(int number, const int * which)
           delete [] deleted;
      }
 #ifndef CLP_NO_STD
+     deleteNameHash();
      // Now works if which out of order
      if (lengthNames_) {
           char * mark = new char [numberRows_];
@@ -1494,12 +1620,16 @@ ClpModel::deleteRows(int number, const int * which)
      secondaryStatus_ = 0;
      delete [] ray_;
      ray_ = NULL;
-     if (savedRowScale_ != rowScale_) {
-          delete [] rowScale_;
-          delete [] columnScale_;
+     if (keepScale) {
+          inverseRowScale_ = rowScale_ + numberRows_;
+     } else {
+          if (savedRowScale_ != rowScale_) {
+               delete [] rowScale_;
+               delete [] columnScale_;
+          }
+          rowScale_ = NULL;
+          columnScale_ = NULL;
      }
-     rowScale_ = NULL;
-     columnScale_ = NULL;
      delete scaledMatrix_;
      scaledMatrix_ = NULL;
 }
@@ -1521,6 +1651,15 @@ ClpModel::deleteColumns(int number, const int * which)
                                  number, which, newSize);
      columnUpper_ = deleteDouble(columnUpper_, numberColumns_,
                                  number, which, newSize);
+     // keep scale factors of surviving columns (rows unchanged)
+     bool keepScale = false;
+     if (columnScale_ && rowScale_ && rowScale_ != savedRowScale_ &&
+               matrix_->type() == 1) {
+          int newSize2 = 0;
+          columnScale_ = deleteScale(columnScale_, numberColumns_,
+                                     number, which, newSize2);
+          keepScale = (columnScale_ != NULL);
+     }
      // possible matrix is not full
      if (matrix_->getNumCols() < numberColumns_) {
           int * which2 = new int [number];
@@ -1558,6 +1697,7 @@ ClpModel::deleteColumns(int number, const int * which)
      integerType_ = deleteChar(integerType_, numberColumns_,
                                number, which, newSize, true);
 #ifndef CLP_NO_STD
+     deleteNameHash();
      // Now works if which out of order
      if (lengthNames_) {
           char * mark = new char [numberColumns_];
@@ -1580,8 +1720,14 @@ ClpModel::deleteColumns(int number, const int * which)
      secondaryStatus_ = 0;
      delete [] ray_;
      ray_ = NULL;
-     setRowScale(NULL);
-     setColumnScale(NULL);
+     if (keepScale) {
+          inverseColumnScale_ = columnScale_ + numberColumns_;
+     } else {
+          setRowScale(NULL);
+          setColumnScale(NULL);
+     }
+     delete scaledMatrix_;
+     scaledMatrix_ = NULL;
 }
 // Deletes rows AND columns (does not reallocate)
 void 
@@ -1622,6 +1768,7 @@ ClpModel::deleteRowsAndColumns(int numberRows, const int * whichRows,
     integerType_ = deleteChar(integerType_, numberColumns_,
 			      numberColumns, whichColumns, newNumberColumns, true);
 #ifndef CLP_NO_STD
+    deleteNameHash();
     // Now works if which out of order
     if (lengthNames_) {
       for (int i=0;i<numberColumns_;i++) {
@@ -1718,6 +1865,33 @@ ClpModel::deleteRowsAndColumns(int numberRows, const int * whichRows,
       matrix_->deleteRows(numberRows, whichRows);
       matrix_->deleteCols(numberColumns, whichColumns);
     }
+    // keep scale factors of survivors
+    bool keepScale = (rowScale_ && columnScale_ && rowScale_ != savedRowScale_ &&
+		      matrix_->type() == 1 && newNumberRows && newNumberColumns);
+    if (keepScale) {
+      double * newRowScale = new double [2*newNumberRows];
+      for (int i=0;i<numberRows_;i++) {
+	int iRow=backRows[i];
+	if (iRow>=0) {
+	  newRowScale[iRow] = rowScale_[i];
+	  newRowScale[iRow+newNumberRows] = rowScale_[i+numberRows_];
+	}
+      }
+      double * newColumnScale = new double [2*newNumberColumns];
+      for (int i=0;i<numberColumns_;i++) {
+	int iColumn=backColumns[i];
+	if (iColumn>=0) {
+	  newColumnScale[iColumn] = columnScale_[i];
+	  newColumnScale[iColumn+newNumberColumns] = columnScale_[i+numberColumns_];
+	}
+      }
+      delete [] rowScale_;
+      delete [] columnScale_;
+      rowScale_ = newRowScale;
+      columnScale_ = newColumnScale;
+      inverseRowScale_ = rowScale_ + newNumberRows;
+      inverseColumnScale_ = columnScale_ + newNumberColumns;
+    }
     numberColumns_ = newNumberColumns;
     numberRows_ = newNumberRows;
     delete [] backRows;
@@ -1726,12 +1900,14 @@ ClpModel::deleteRowsAndColumns(int numberRows, const int * whichRows,
     secondaryStatus_ = 0;
     delete [] ray_;
     ray_ = NULL;
-    if (savedRowScale_ != rowScale_) {
-      delete [] rowScale_;
-      delete [] columnScale_;
+    if (!keepScale) {
+      if (savedRowScale_ != rowScale_) {
+	delete [] rowScale_;
+	delete [] columnScale_;
+      }
+      rowScale_ = NULL;
+      columnScale_ = NULL;
     }
-    rowScale_ = NULL;
-    columnScale_ = NULL;
     delete scaledMatrix_;
     scaledMatrix_ = NULL;
     delete rowCopy_;
@@ -2074,6 +2250,118 @@ ClpModel::addRows(const CoinBuild & buildObject, bool tryPlusMinusOne, bool chec
      }
      return numberErrors;
 }
+// Add rows from several build objects
+int
+ClpModel::addRows(int numberBuilds, const CoinBuild * const * builds,
+                  bool checkDuplicates)
+{
+     int number = 0;
+     CoinBigIndex numberElements = 0;
+     bool inRange = true;
+     for (int iBuild = 0; iBuild < numberBuilds; iBuild++) {
+          if (!builds[iBuild]->numberElements() && builds[iBuild]->type() < 0)
+               continue; // never used
+          CoinAssertHint (builds[iBuild]->type() == 0, "Looks as if both addRows and addCols being used");
+          number += builds[iBuild]->numberRows();
+          numberElements += builds[iBuild]->numberElements();
+          if (builds[iBuild]->numberColumns() > numberColumns_)
+               inRange = false;
+     }
+     if (!number)
+          return 0;
+     ClpPackedMatrix * clpMatrix = dynamic_cast< ClpPackedMatrix*>(matrix_);
+     if (!clpMatrix || clpMatrix->getNumElements() || !inRange) {
+          // add one at a time
+          int numberErrors = 0;
+          for (int iBuild = 0; iBuild < numberBuilds; iBuild++) {
+               if (builds[iBuild]->numberRows())
+                    numberErrors += addRows(*builds[iBuild], false, checkDuplicates);
+          }
+          return numberErrors;
+     }
+     /* No elements yet so can go straight to column copy.
+        First pass counts (and checks), second pass is counting sort */
+     double * lower = new double [number];
+     double * upper = new double [number];
+     int * length = new int [numberColumns_];
+     CoinZeroN(length, numberColumns_);
+     int * mark = NULL;
+     if (checkDuplicates) {
+          mark = new int [numberColumns_];
+          CoinFillN(mark, numberColumns_, -1);
+     }
+     int numberErrors = 0;
+     int iRow = 0;
+     for (int iBuild = 0; iBuild < numberBuilds; iBuild++) {
+          const CoinBuild * build = builds[iBuild];
+          int numberInBuild = build->numberRows();
+          for (int i = 0; i < numberInBuild; i++) {
+               const int * columns;
+               const double * elements;
+               int n = build->row(i, lower[iRow], upper[iRow], columns, elements);
+               for (int j = 0; j < n; j++) {
+                    int iColumn = columns[j];
+                    if (mark) {
+                         if (mark[iColumn] == iRow)
+                              numberErrors++;
+                         mark[iColumn] = iRow;
+                    }
+                    length[iColumn]++;
+               }
+               iRow++;
+          }
+     }
+     delete [] mark;
+     if (numberErrors) {
+          // let normal code deal with duplicates
+          delete [] lower;
+          delete [] upper;
+          delete [] length;
+          numberErrors = 0;
+          for (int iBuild = 0; iBuild < numberBuilds; iBuild++) {
+               if (builds[iBuild]->numberRows())
+                    numberErrors += addRows(*builds[iBuild], false, checkDuplicates);
+          }
+          return numberErrors;
+     }
+     CoinBigIndex * start = new CoinBigIndex [numberColumns_+1];
+     int * row = new int [numberElements];
+     double * element = new double [numberElements];
+     // put is where next element of column goes
+     CoinBigIndex * put = new CoinBigIndex [numberColumns_];
+     start[0] = 0;
+     for (int iColumn = 0; iColumn < numberColumns_; iColumn++) {
+          put[iColumn] = start[iColumn];
+          start[iColumn+1] = start[iColumn] + length[iColumn];
+     }
+     iRow = numberRows_;
+     for (int iBuild = 0; iBuild < numberBuilds; iBuild++) {
+          const CoinBuild * build = builds[iBuild];
+          int numberInBuild = build->numberRows();
+          for (int i = 0; i < numberInBuild; i++) {
+               const int * columns;
+               const double * elements;
+               double dummyLower, dummyUpper;
+               int n = build->row(i, dummyLower, dummyUpper, columns, elements);
+               for (int j = 0; j < n; j++) {
+                    CoinBigIndex k = put[columns[j]]++;
+                    row[k] = iRow;
+                    element[k] = elements[j];
+               }
+               iRow++;
+          }
+     }
+     delete [] put;
+     addRows(number, lower, upper, NULL);
+     delete [] lower;
+     delete [] upper;
+     // matrix takes ownership of arrays
+     CoinPackedMatrix * matrix = new CoinPackedMatrix();
+     matrix->assignMatrix(true, numberRows_, numberColumns_, numberElements,
+                          element, row, start, length);
+     replaceMatrix(matrix, true);
+     return 0;
+}
 #endif
 #ifndef SLIM_NOIO
 // Add rows from a model object
@@ -2232,6 +2520,16 @@ ClpModel::addColumns(int number, const double * columnLower,
      if (number) {
           whatsChanged_ &= ~(1 + 2 + 4 + 64 + 128 + 256); // all except rows changed
           int numberColumnsNow = numberColumns_;
+          // keep scales so new columns can be scaled against existing rows
+          double * saveRowScale = NULL;
+          double * saveColumnScale = NULL;
+          if (rowScale_ && columnScale_ && rowScale_ != savedRowScale_ &&
+                    matrix_ && matrix_->type() == 1) {
+               saveRowScale = rowScale_;
+               saveColumnScale = columnScale_;
+               rowScale_ = NULL;
+               columnScale_ = NULL;
+          }
           resize(numberRows_, numberColumnsNow + number);
           double * lower = columnLower_ + numberColumnsNow;
           double * upper = columnUpper_ + numberColumnsNow;
@@ -2287,6 +2585,7 @@ ClpModel::addColumns(int number, const double * columnLower,
 #endif
           // Do even if elements NULL (to resize)
 	  matrix_->appendMatrix(number, 1, columnStarts, rows, elements);
+          scaleAddedColumns(numberColumnsNow, saveRowScale, saveColumnScale);
      }
 }
 // Add columns
@@ -2334,6 +2633,16 @@ ClpModel::addColumns(int number, const double * columnLower,
           return;
      whatsChanged_ &= ~(1 + 2 + 4 + 64 + 128 + 256); // all except rows changed
      int numberColumnsNow = numberColumns_;
+     // keep scales so new columns can be scaled against existing rows
+     double * saveRowScale = NULL;
+     double * saveColumnScale = NULL;
+     if (rowScale_ && columnScale_ && rowScale_ != savedRowScale_ &&
+               matrix_ && matrix_->type() == 1) {
+          saveRowScale = rowScale_;
+          saveColumnScale = columnScale_;
+          rowScale_ = NULL;
+          columnScale_ = NULL;
+     }
      resize(numberRows_, numberColumnsNow + number);
      double * lower = columnLower_ + numberColumnsNow;
      double * upper = columnUpper_ + numberColumnsNow;
@@ -2384,6 +2693,7 @@ ClpModel::addColumns(int number, const double * columnLower,
           matrix_->appendCols(number, columns);
      setRowScale(NULL);
      setColumnScale(NULL);
+     scaleAddedColumns(numberColumnsNow, saveRowScale, saveColumnScale);
      if (lengthNames_) {
           columnNames_.resize(numberColumns_);
      }
@@ -2448,11 +2758,28 @@ ClpModel::addColumns(const CoinBuild & buildObject, bool tryPlusMinusOne, bool c
                     numberElements += numberElementsThis;
                     starts[iColumn+1] = numberElements;
                }
+               // keep scales so new columns can be scaled against existing rows
+               int numberColumnsNow = numberColumns_;
+               double * saveRowScale = NULL;
+               double * saveColumnScale = NULL;
+               if (rowScale_ && columnScale_ && rowScale_ != savedRowScale_ &&
+                         matrix_ && matrix_->type() == 1) {
+                    saveRowScale = rowScale_;
+                    saveColumnScale = columnScale_;
+                    rowScale_ = NULL;
+                    columnScale_ = NULL;
+               }
                addColumns(number, lower, upper, objective, NULL);
                // make sure matrix has enough rows
                matrix_->setDimensions(numberRows_, -1);
                numberErrors = matrix_->appendMatrix(number, 1, starts, row, element,
                                                     checkDuplicates ? numberRows_ : -1);
+               if (numberErrors) {
+                    delete [] saveRowScale;
+                    delete [] saveColumnScale;
+               } else {
+                    scaleAddedColumns(numberColumnsNow, saveRowScale, saveColumnScale);
+               }
                delete [] starts;
                delete [] row;
                delete [] element;
@@ -2524,6 +2851,105 @@ ClpModel::addColumns(const CoinBuild & buildObject, bool tryPlusMinusOne, bool c
      }
      return 0;
 }
+// Add columns from several build objects
+int
+ClpModel::addColumns(int numberBuilds, const CoinBuild * const * builds,
+                     bool checkDuplicates)
+{
+     int number = 0;
+     CoinBigIndex numberElements = 0;
+     bool inRange = true;
+     for (int iBuild = 0; iBuild < numberBuilds; iBuild++) {
+          if (!builds[iBuild]->numberElements() && builds[iBuild]->type() < 0)
+               continue; // never used
+          CoinAssertHint (builds[iBuild]->type() == 1, "Looks as if both addRows and addCols being used");
+          number += builds[iBuild]->numberColumns();
+          numberElements += builds[iBuild]->numberElements();
+          if (builds[iBuild]->numberRows() > numberRows_)
+               inRange = false;
+     }
+     if (!number)
+          return 0;
+     ClpPackedMatrix * clpMatrix = dynamic_cast< ClpPackedMatrix*>(matrix_);
+     if (!clpMatrix || clpMatrix->getNumElements() || !inRange) {
+          // add one at a time
+          int numberErrors = 0;
+          for (int iBuild = 0; iBuild < numberBuilds; iBuild++) {
+               if (builds[iBuild]->numberColumns())
+                    numberErrors += addColumns(*builds[iBuild], false, checkDuplicates);
+          }
+          return numberErrors;
+     }
+     // No elements yet so columns can just be put end to end
+     double * lower = new double [number];
+     double * upper = new double [number];
+     double * objective = new double [number];
+     CoinBigIndex * start = new CoinBigIndex [numberColumns_+number+1];
+     int * length = new int [numberColumns_+number];
+     int * row = new int [numberElements];
+     double * element = new double [numberElements];
+     CoinZeroN(start, numberColumns_ + 1);
+     CoinZeroN(length, numberColumns_);
+     int * mark = NULL;
+     if (checkDuplicates) {
+          mark = new int [numberRows_];
+          CoinFillN(mark, numberRows_, -1);
+     }
+     int numberErrors = 0;
+     int iColumn = 0;
+     numberElements = 0;
+     for (int iBuild = 0; iBuild < numberBuilds; iBuild++) {
+          const CoinBuild * build = builds[iBuild];
+          int numberInBuild = build->numberColumns();
+          for (int i = 0; i < numberInBuild; i++) {
+               const int * rows;
+               const double * elements;
+               int n = build->column(i, lower[iColumn], upper[iColumn],
+                                     objective[iColumn], rows, elements);
+               if (mark) {
+                    for (int j = 0; j < n; j++) {
+                         int iRow = rows[j];
+                         if (mark[iRow] == iColumn)
+                              numberErrors++;
+                         mark[iRow] = iColumn;
+                    }
+               }
+               CoinMemcpyN(rows, n, row + numberElements);
+               CoinMemcpyN(elements, n, element + numberElements);
+               numberElements += n;
+               length[numberColumns_+iColumn] = n;
+               iColumn++;
+               start[numberColumns_+iColumn] = numberElements;
+          }
+     }
+     delete [] mark;
+     if (numberErrors) {
+          // let normal code deal with duplicates
+          delete [] lower;
+          delete [] upper;
+          delete [] objective;
+          delete [] start;
+          delete [] length;
+          delete [] row;
+          delete [] element;
+          numberErrors = 0;
+          for (int iBuild = 0; iBuild < numberBuilds; iBuild++) {
+               if (builds[iBuild]->numberColumns())
+                    numberErrors += addColumns(*builds[iBuild], false, checkDuplicates);
+          }
+          return numberErrors;
+     }
+     addColumns(number, lower, upper, objective, NULL);
+     delete [] lower;
+     delete [] upper;
+     delete [] objective;
+     // matrix takes ownership of arrays
+     CoinPackedMatrix * matrix = new CoinPackedMatrix();
+     matrix->assignMatrix(true, numberRows_, numberColumns_, numberElements,
+                          element, row, start, length);
+     replaceMatrix(matrix, true);
+     return 0;
+}
 #endif
 #ifndef SLIM_NOIO
 // Add columns from a model object
@@ -2791,12 +3217,23 @@ ClpModel::setMaximumSeconds(double value)
      else
           dblParam_[ClpMaxSeconds] = -1.0;
 }
-// Returns true if hit maximum iterations (or time)
+void
+ClpModel::setMaximumWorkUnits(double value)
+{
+     if(value >= 0)
+          maximumWorkUnits_ = value + workUnits_;
+     else
+          maximumWorkUnits_ = -1.0;
+}
+// Returns true if hit maximum iterations (or time or work)
 bool
 ClpModel::hitMaximumIterations() const
 {
      // replaced - compiler error? bool hitMax= (numberIterations_>=maximumIterations());
      bool hitMax = (numberIterations_ >= intParam_[ClpMaxNumIteration]);
+     if (maximumWorkUnits_ >= 0.0 && !hitMax) {
+          hitMax = (workUnits_ >= maximumWorkUnits_);
+     }
      if (dblParam_[ClpMaxSeconds] >= 0.0 && !hitMax) {
           hitMax = (CoinCpuTime() >= dblParam_[ClpMaxSeconds]);
      }
@@ -2810,6 +3247,8 @@ ClpModel::onStopped()
           secondaryStatus_ = 0;
           if (CoinCpuTime() >= dblParam_[ClpMaxSeconds] && dblParam_[ClpMaxSeconds] >= 0.0)
                secondaryStatus_ = 9;
+          else if (maximumWorkUnits_ >= 0.0 && workUnits_ >= maximumWorkUnits_)
+               secondaryStatus_ = 11;
      }
 }
 // Pass in Message handler (not deleted at end)
@@ -2923,6 +3362,7 @@ ClpModel::readMps(const char *fileName,
           if (keepNames) {
                unsigned int maxLength = 0;
                int iRow;
+               deleteNameHash();
                rowNames_ = std::vector<std::string> ();
                columnNames_ = std::vector<std::string> ();
                rowNames_.reserve(numberRows_);
@@ -3007,6 +3447,7 @@ ClpModel::readGMPL(const char *fileName, const char * dataName,
           if (keepNames) {
                unsigned int maxLength = 0;
                int iRow;
+               deleteNameHash();
                rowNames_ = std::vector<std::string> ();
                columnNames_ = std::vector<std::string> ();
                rowNames_.reserve(numberRows_);
@@ -3142,6 +3583,7 @@ void
 ClpModel::dropNames()
 {
      lengthNames_ = 0;
+     deleteNameHash();
      rowNames_ = std::vector<std::string> ();
      columnNames_ = std::vector<std::string> ();
 }
@@ -3271,6 +3713,9 @@ ClpModel::ClpModel ( const ClpModel * rhs,
                      int numberColumns, const int * whichColumn,
                      bool dropNames, bool dropIntegers)
      :  specialOptions_(rhs->specialOptions_),
+#ifndef CLP_NO_STD
+        nameHashing_(rhs->nameHashing_),
+#endif
         maximumColumns_(-1),
         maximumRows_(-1),
         maximumInternalColumns_(-1),
@@ -3278,6 +3723,13 @@ ClpModel::ClpModel ( const ClpModel * rhs,
         savedRowScale_(NULL),
         savedColumnScale_(NULL)
 {
+#ifndef CLP_NO_STD
+     for (int i = 0; i < 2; i++) {
+          nameHash_[i] = NULL;
+          nameHashSize_[i] = 0;
+          nameHashCount_[i] = 0;
+     }
+#endif
      defaultHandler_ = rhs->defaultHandler_;
      if (defaultHandler_)
           handler_ = new CoinMessageHandler(*rhs->handler_);
@@ -3305,6 +3757,8 @@ ClpModel::ClpModel ( const ClpModel * rhs,
      dblParam_[ClpObjOffset] = rhs->dblParam_[ClpObjOffset];
      dblParam_[ClpMaxSeconds] = rhs->dblParam_[ClpMaxSeconds];
      dblParam_[ClpPresolveTolerance] = rhs->dblParam_[ClpPresolveTolerance];
+     workUnits_ = rhs->workUnits_;
+     maximumWorkUnits_ = rhs->maximumWorkUnits_;
 #ifndef CLP_NO_STD
      strParam_[ClpProbName] = rhs->strParam_[ClpProbName];
 #endif
@@ -3340,6 +3794,7 @@ ClpModel::ClpModel ( const ClpModel * rhs,
      if (!dropNames) {
           unsigned int maxLength = 0;
           int iRow;
+          deleteNameHash();
           rowNames_ = std::vector<std::string> ();
           columnNames_ = std::vector<std::string> ();
           rowNames_.reserve(numberRows_);
@@ -3356,6 +3811,7 @@ ClpModel::ClpModel ( const ClpModel * rhs,
           lengthNames_ = static_cast<int> (maxLength);
      } else {
           lengthNames_ = 0;
+          deleteNameHash();
           rowNames_ = std::vector<std::string> ();
           columnNames_ = std::vector<std::string> ();
      }
@@ -3428,6 +3884,7 @@ ClpModel::copyNames(const std::vector<std::string> & rowNames,
 {
      unsigned int maxLength = 0;
      int iRow;
+     deleteNameHash();
      rowNames_ = std::vector<std::string> ();
      columnNames_ = std::vector<std::string> ();
      rowNames_.reserve(numberRows_);
@@ -3443,6 +3900,134 @@ ClpModel::copyNames(const std::vector<std::string> & rowNames,
      }
      lengthNames_ = static_cast<int> (maxLength);
 }
+/* Name hash tables are open addressing with linear probing and hold
+   indices into rowNames_ or columnNames_ so names are not stored twice */
+static inline int
+nameHashValue(const std::string & name)
+{
+     // FNV-1a
+     unsigned int hash = 2166136261u;
+     for (size_t i = 0; i < name.size(); i++) {
+          hash ^= static_cast<unsigned char> (name[i]);
+          hash *= 16777619u;
+     }
+     return static_cast<int> (hash & 0x7fffffff);
+}
+static inline void
+nameHashInsert(int * hash, int mask, int index,
+               const std::vector<std::string> & names)
+{
+     int j = nameHashValue(names[index]) & mask;
+     while (hash[j] >= 0)
+          j = (j + 1) & mask;
+     hash[j] = index;
+}
+// Empties slot and moves up any entries which would then not be found
+static void
+nameHashRemove(int * hash, int mask, int slot,
+               const std::vector<std::string> & names)
+{
+     hash[slot] = -1;
+     int j = slot;
+     while (true) {
+          j = (j + 1) & mask;
+          if (hash[j] < 0)
+               break;
+          int home = nameHashValue(names[hash[j]]) & mask;
+          // can move if home is not cyclically in (slot, j]
+          bool inRange = (slot <= j) ? (home > slot && home <= j) :
+                         (home > slot || home <= j);
+          if (!inRange) {
+               hash[slot] = hash[j];
+               hash[j] = -1;
+               slot = j;
+          }
+     }
+}
+// Deletes name hash tables (rebuilt when next needed)
+void
+ClpModel::deleteNameHash()
+{
+     for (int i = 0; i < 2; i++) {
+          delete [] nameHash_[i];
+          nameHash_[i] = NULL;
+          nameHashSize_[i] = 0;
+          nameHashCount_[i] = 0;
+     }
+}
+// Brings hash table of row (0) or column (1) names up to date
+void
+ClpModel::updateNameHash(int which) const
+{
+     const std::vector<std::string> & names = which ? columnNames_ : rowNames_;
+     int number = CoinMin(static_cast<int> (names.size()),
+                          which ? numberColumns_ : numberRows_);
+     int first = nameHashCount_[which];
+     if (first > number || 2 * number > nameHashSize_[which]) {
+          // (re)build
+          int size = 16;
+          while (size < 2 * number)
+               size *= 2;
+          if (size != nameHashSize_[which]) {
+               delete [] nameHash_[which];
+               nameHash_[which] = new int [size];
+               nameHashSize_[which] = size;
+          }
+          first = 0;
+          for (int i = 0; i < size; i++)
+               nameHash_[which][i] = -1;
+     }
+     // new names at end
+     int mask = nameHashSize_[which] - 1;
+     for (int i = first; i < number; i++)
+          nameHashInsert(nameHash_[which], mask, i, names);
+     nameHashCount_[which] = number;
+}
+// Returns index of name in rows (0) or columns (1) or -1
+int
+ClpModel::findName(int which, const std::string & name) const
+{
+     const std::vector<std::string> & names = which ? columnNames_ : rowNames_;
+     if (!nameHashing_) {
+          int number = CoinMin(static_cast<int> (names.size()),
+                               which ? numberColumns_ : numberRows_);
+          for (int i = 0; i < number; i++) {
+               if (names[i] == name)
+                    return i;
+          }
+          return -1;
+     }
+     updateNameHash(which);
+     const int * hash = nameHash_[which];
+     int mask = nameHashSize_[which] - 1;
+     int found = -1;
+     for (int j = nameHashValue(name) & mask; hash[j] >= 0; j = (j + 1) & mask) {
+          int index = hash[j];
+          if ((found < 0 || index < found) && names[index] == name)
+               found = index;
+     }
+     return found;
+}
+// Switch on (or off) hashing of names
+void
+ClpModel::setNameHashing(bool onOff)
+{
+     nameHashing_ = onOff;
+     if (!onOff)
+          deleteNameHash();
+}
+// Returns (first) row with given name or -1
+int
+ClpModel::rowIndex(const std::string & name) const
+{
+     return findName(0, name);
+}
+// Returns (first) column with given name or -1
+int
+ClpModel::columnIndex(const std::string & name) const
+{
+     return findName(1, name);
+}
 // Return name or Rnnnnnnn
 std::string
 ClpModel::getRowName(int iRow) const
@@ -3475,7 +4060,19 @@ ClpModel::setRowName(int iRow, std::string &name)
      int size = static_cast<int>(rowNames_.size());
      if (size <= iRow)
           rowNames_.resize(iRow + 1);
-     rowNames_[iRow] = name;
+     if (iRow < nameHashCount_[0]) {
+          // take out old name and put in new
+          int * hash = nameHash_[0];
+          int mask = nameHashSize_[0] - 1;
+          int j = nameHashValue(rowNames_[iRow]) & mask;
+          while (hash[j] != iRow)
+               j = (j + 1) & mask;
+          nameHashRemove(hash, mask, j, rowNames_);
+          rowNames_[iRow] = name;
+          nameHashInsert(hash, mask, iRow, rowNames_);
+     } else {
+          rowNames_[iRow] = name;
+     }
      maxLength = CoinMax(maxLength, static_cast<unsigned int> (strlen(name.c_str())));
      // May be too big - but we would have to check both rows and columns to be exact
      lengthNames_ = static_cast<int> (maxLength);
@@ -3512,7 +4109,19 @@ ClpModel::setColumnName(int iColumn, std::string &name)
      int size = static_cast<int>(columnNames_.size());
      if (size <= iColumn)
           columnNames_.resize(iColumn + 1);
-     columnNames_[iColumn] = name;
+     if (iColumn < nameHashCount_[1]) {
+          // take out old name and put in new
+          int * hash = nameHash_[1];
+          int mask = nameHashSize_[1] - 1;
+          int j = nameHashValue(columnNames_[iColumn]) & mask;
+          while (hash[j] != iColumn)
+               j = (j + 1) & mask;
+          nameHashRemove(hash, mask, j, columnNames_);
+          columnNames_[iColumn] = name;
+          nameHashInsert(hash, mask, iColumn, columnNames_);
+     } else {
+          columnNames_[iColumn] = name;
+     }
      maxLength = CoinMax(maxLength, static_cast<unsigned int> (strlen(name.c_str())));
      // May be too big - but we would have to check both columns and columns to be exact
      lengthNames_ = static_cast<int> (maxLength);
@@ -3527,6 +4136,8 @@ ClpModel::copyRowNames(const std::vector<std::string> & rowNames, int first, int
        copyColumnNames(NULL,0,numberColumns_);
      }
      unsigned int maxLength = lengthNames_;
+     if (first < nameHashCount_[0])
+          deleteNameHash();
      int size = static_cast<int>(rowNames_.size());
      if (size != numberRows_)
           rowNames_.resize(numberRows_);
@@ -3548,6 +4159,8 @@ ClpModel::copyColumnNames(const std::vector<std::string> & columnNames, int firs
        copyRowNames(NULL,0,numberRows_);
      }
      unsigned int maxLength = lengthNames_;
+     if (first < nameHashCount_[1])
+          deleteNameHash();
      int size = static_cast<int>(columnNames_.size());
      if (size != numberColumns_)
           columnNames_.resize(numberColumns_);
@@ -3569,6 +4182,8 @@ ClpModel::copyRowNames(const char * const * rowNames, int first, int last)
        copyColumnNames(NULL,0,numberColumns_);
      }
      unsigned int maxLength = lengthNames_;
+     if (first < nameHashCount_[0])
+          deleteNameHash();
      int size = static_cast<int>(rowNames_.size());
      if (size != numberRows_)
           rowNames_.resize(numberRows_);
@@ -3597,6 +4212,8 @@ ClpModel::copyColumnNames(const char * const * columnNames, int first, int last)
        copyRowNames(NULL,0,numberRows_);
      }
      unsigned int maxLength = lengthNames_;
+     if (first < nameHashCount_[1])
+          deleteNameHash();
      int size = static_cast<int>(columnNames_.size());
      if (size != numberColumns_)
           columnNames_.resize(numberColumns_);
@@ -4008,6 +4625,37 @@ ClpModel::gutsOfScaling()
      matrix_->reallyScale(rowScale_, columnScale_);
      objective_->reallyScale(columnScale_);
 }
+/* Takes over scales saved before adding columns from firstColumn on.
+   New columns are scaled against existing row scales unless that
+   would be poor, in which case scaling is redone on next solve */
+void
+ClpModel::scaleAddedColumns(int firstColumn, double * rowScale,
+                            double * columnScale)
+{
+     if (!rowScale)
+          return;
+     ClpPackedMatrix * clpMatrix = dynamic_cast<ClpPackedMatrix *>(matrix_);
+     bool keep = (clpMatrix && !rowScale_ && !columnScale_ &&
+                  clpMatrix->getNumCols() == numberColumns_);
+     if (keep) {
+          double * newColumnScale = new double [2*numberColumns_];
+          CoinMemcpyN(columnScale, firstColumn, newColumnScale);
+          CoinMemcpyN(columnScale + firstColumn, firstColumn,
+                      newColumnScale + numberColumns_);
+          if (!clpMatrix->scaleNewColumns(this, firstColumn, rowScale,
+                                          newColumnScale)) {
+               rowScale_ = rowScale;
+               columnScale_ = newColumnScale;
+               inverseRowScale_ = rowScale_ + numberRows_;
+               inverseColumnScale_ = columnScale_ + numberColumns_;
+               rowScale = NULL;
+          } else {
+               delete [] newColumnScale;
+          }
+     }
+     delete [] rowScale;
+     delete [] columnScale;
+}
 /* If we constructed a "really" scaled model then this reverses the operation.
       Quantities may not be exactly as they were before due to rounding errors */
 void
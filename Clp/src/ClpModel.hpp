@@ -99,6 +99,16 @@ public:
                          const double* obj,
                          const double* rowlb, const double* rowub,
                          const double * rowObjective = NULL);
+     /** Loads a problem by taking over the arguments instead of copying
+         them, so a big model is not held twice.  The matrix must have been
+         created with new and the arrays with new [] (NULL arrays get the
+         defaults listed above).  On return all the arguments are NULL.
+         A row ordered matrix is reordered (which does need a temporary
+         copy of the elements).
+     */
+     void assignProblem (  CoinPackedMatrix *& matrix,
+                           double *& collb, double *& colub, double *& obj,
+                           double *& rowlb, double *& rowub);
      /** This loads a model from a coinModel object - returns number of errors.
 
          modelObject not const as may be changed as part of process
@@ -141,7 +151,8 @@ public:
      bool isInteger(int index) const;
      /// Resizes rim part of model
      void resize (int newNumberRows, int newNumberColumns);
-     /// Deletes rows
+     /** Deletes rows.
+         Scale factors of surviving rows are kept so next solve need not rescale */
      void deleteRows(int number, const int * which);
      /// Add one row
      void addRow(int numberInRow, const int * columns,
@@ -170,6 +181,14 @@ public:
      */
      int addRows(const CoinBuild & buildObject, bool tryPlusMinusOne = false,
                  bool checkDuplicates = true);
+     /** Add rows from several build objects, taken in order.  Each can be
+         filled by a different thread.  If there are no elements yet the
+         column copy is created directly (by a counting sort) and handed
+         to the matrix without copying.
+         Returns number of errors e.g. duplicates
+     */
+     int addRows(int numberBuilds, const CoinBuild * const * builds,
+                 bool checkDuplicates = true);
      /** Add rows from a model object.  returns
          -1 if object in bad state (i.e. has column information)
          otherwise number of errors.
@@ -181,7 +200,8 @@ public:
      int addRows(CoinModel & modelObject, bool tryPlusMinusOne = false,
                  bool checkDuplicates = true);
 
-     /// Deletes columns
+     /** Deletes columns.
+         Scale factors of surviving columns are kept so next solve need not rescale */
      void deleteColumns(int number, const int * which);
      /// Deletes rows AND columns (keeps old sizes)
      void deleteRowsAndColumns(int numberRows, const int * whichRows,
@@ -218,6 +238,13 @@ public:
      */
      int addColumns(const CoinBuild & buildObject, bool tryPlusMinusOne = false,
                     bool checkDuplicates = true);
+     /** Add columns from several build objects, taken in order.  Each can
+         be filled by a different thread.  If there are no elements yet the
+         columns are put end to end and handed to the matrix without copying.
+         Returns number of errors e.g. duplicates
+     */
+     int addColumns(int numberBuilds, const CoinBuild * const * builds,
+                    bool checkDuplicates = true);
      /** Add columns from a model object.  returns
          -1 if object in bad state (i.e. has row information)
          otherwise number of errors
@@ -299,7 +326,7 @@ public:
      formatType is
      <ul>
        <li> 0 - normal
-       <li> 1 - extra accuracy
+       <li> 1 - extra accuracy (reads back exactly)
        <li> 2 - IEEE hex
      </ul>
 
@@ -386,7 +413,30 @@ public:
           return dblParam_[ClpMaxSeconds];
      }
      void setMaximumSeconds(double value);
-     /// Returns true if hit maximum iterations (or time)
+     /** Deterministic work done so far.  A unit is roughly one nonzero
+         touched - counted from vectors going in and out of ftran, btran,
+         transposeTimes, pricing and ratio test and from size of
+         factorization.  Only simplex counts work.  Same model and options
+         give same count on any machine. */
+     inline double workUnits() const {
+          return workUnits_;
+     }
+     /// Adds to work done so far
+     inline void addWorkUnits(double value) const {
+          workUnits_ += value;
+     }
+     /// Sets work done so far (e.g. to zero)
+     inline void setWorkUnits(double value) {
+          workUnits_ = value;
+     }
+     /// Maximum work units (from when set called) or -1.0 if none
+     inline double maximumWorkUnits() const {
+          return maximumWorkUnits_;
+     }
+     /** Stops as if maximum iterations reached after value more work
+         units.  Negative means no limit */
+     void setMaximumWorkUnits(double value);
+     /// Returns true if hit maximum iterations (or time or work)
      bool hitMaximumIterations() const;
      /** Status of problem:
          -1 - unknown e.g. before solve or if postSolve says not optimal
@@ -420,6 +470,7 @@ public:
          8 - failed due to bad element check
          9 - status was 3 and stopped on time
 	 10 - status was 3 but stopped as primal feasible
+         11 - status was 3 and stopped on work units
          100 up - translation of enum from ClpEventHandler
      */
      inline int secondaryStatus() const            {
@@ -925,6 +976,19 @@ public:
      }
      /// Return name or Cnnnnnnn
      std::string getColumnName(int iColumn) const;
+     /** Switch on (or off) hashing of names so rowIndex and columnIndex
+         do not have to search.  The hash tables only hold indices into
+         the name vectors - they are built when first used and then kept
+         up to date as names are changed, added or deleted. */
+     void setNameHashing(bool onOff);
+     /// Whether names are hashed
+     inline bool nameHashing() const {
+          return nameHashing_;
+     }
+     /// Returns (first) row with given name or -1
+     int rowIndex(const std::string & name) const;
+     /// Returns (first) column with given name or -1
+     int columnIndex(const std::string & name) const;
 #endif
      /// Objective methods
      inline ClpObjective * objectiveAsObject() const {
@@ -1076,8 +1140,17 @@ protected:
                             const double* obj,
                             const double* rowlb, const double* rowub,
                             const double * rowObjective = NULL);
+     /// Start of loading - deletes old model and creates solution arrays
+     void startLoadModel(int numberRows, int numberColumns);
+     /// End of loading - cleans bounds and sets default solution
+     void finishLoadModel();
      /// Does much of scaling
      void gutsOfScaling();
+     /** Takes over scales saved before adding columns from firstColumn on.
+         New columns are scaled against existing row scales unless that
+         would be poor, in which case scaling is redone on next solve */
+     void scaleAddedColumns(int firstColumn, double * rowScale,
+                            double * columnScale);
      /// Objective value - always minimize
      inline double rawObjectiveValue() const {
           return objectiveValue_;
@@ -1096,6 +1169,14 @@ protected:
      const char * const * columnNamesAsChar() const;
      /// Delete char * version of names
      void deleteNamesAsChar(const char * const * names, int number) const;
+#ifndef CLP_NO_STD
+     /// Deletes name hash tables (rebuilt when next needed)
+     void deleteNameHash();
+     /// Brings hash table of row (0) or column (1) names up to date
+     void updateNameHash(int which) const;
+     /// Returns index of name in rows (0) or columns (1) or -1
+     int findName(int which, const std::string & name) const;
+#endif
      /// On stopped - sets secondary status
      void onStopped();
      //@}
@@ -1118,6 +1199,10 @@ protected:
      double objectiveScale_;
      /// Scaling of rhs and bounds
      double rhsScale_;
+     /// Deterministic work done so far
+     mutable double workUnits_;
+     /// Maximum work units (workUnits_ at which to stop) or -1.0
+     double maximumWorkUnits_;
      /// Number of rows
      int numberRows_;
      /// Number of columns
@@ -1235,6 +1320,14 @@ protected:
      std::vector<std::string> rowNames_;
      /// Column names
      std::vector<std::string> columnNames_;
+     /// Hash tables of row [0] and column [1] names (-1 is empty)
+     mutable int * nameHash_[2];
+     /// Size of each hash table (power of 2)
+     mutable int nameHashSize_[2];
+     /// Number of names in each hash table
+     mutable int nameHashCount_[2];
+     /// Whether names are hashed
+     bool nameHashing_;
 #endif
      /// Messages
      CoinMessages messages_;
@@ -56,6 +56,7 @@ ClpPackedMatrix::ClpPackedMatrix ()
        matrix_(NULL),
        numberActiveColumns_(0),
        flags_(2),
+       numberIncrementallyScaled_(0),
        rowCopy_(NULL),
        columnCopy_(NULL)
 {
@@ -82,6 +83,7 @@ ClpPackedMatrix::ClpPackedMatrix (const ClpPackedMatrix & rhs)
      if (matrix_->hasGaps()) flags_ |= 0x02 ;
 #endif
      numberActiveColumns_ = rhs.numberActiveColumns_;
+     numberIncrementallyScaled_ = rhs.numberIncrementallyScaled_;
      int numberRows = matrix_->getNumRows();
      if (rhs.rhsOffset_ && numberRows) {
           rhsOffset_ = ClpCopyOfArray(rhs.rhsOffset_, numberRows);
@@ -113,6 +115,7 @@ ClpPackedMatrix::ClpPackedMatrix (CoinPackedMatrix * rhs)
      matrix_ = rhs;
      flags_ = ((matrix_->hasGaps())?0x02:0) ;
      numberActiveColumns_ = matrix_->getNumCols();
+     numberIncrementallyScaled_ = 0;
      rowCopy_ = NULL;
      columnCopy_ = NULL;
      setType(1);
@@ -133,6 +136,7 @@ ClpPackedMatrix::ClpPackedMatrix (const CoinPackedMatrix & rhs)
      flags_ = ((matrix_->hasGaps())?0x02:0) ;
 #endif
      numberActiveColumns_ = matrix_->getNumCols();
+     numberIncrementallyScaled_ = 0;
      rowCopy_ = NULL;
      columnCopy_ = NULL;
      setType(1);
@@ -170,6 +174,7 @@ ClpPackedMatrix::operator=(const ClpPackedMatrix& rhs)
 	  if (matrix_->hasGaps()) flags_ |= 0x02 ;
 #endif
           numberActiveColumns_ = rhs.numberActiveColumns_;
+          numberIncrementallyScaled_ = rhs.numberIncrementallyScaled_;
           delete rowCopy_;
           delete columnCopy_;
           if (rhs.rowCopy_) {
@@ -230,6 +235,7 @@ ClpPackedMatrix::ClpPackedMatrix (
      matrix_ = new CoinPackedMatrix(*(rhs.matrix_), numberRows, whichRows,
                                     numberColumns, whichColumns);
      numberActiveColumns_ = matrix_->getNumCols();
+     numberIncrementallyScaled_ = 0;
      rowCopy_ = NULL;
      flags_ = rhs.flags_&(~0x02) ; // no gaps
      columnCopy_ = NULL;
@@ -246,6 +252,7 @@ ClpPackedMatrix::ClpPackedMatrix (
      matrix_ = new CoinPackedMatrix(rhs, numberRows, whichRows,
                                     numberColumns, whichColumns);
      numberActiveColumns_ = matrix_->getNumCols();
+     numberIncrementallyScaled_ = 0;
      rowCopy_ = NULL;
      flags_ = 0 ;  // no gaps
      columnCopy_ = NULL;
@@ -591,6 +598,7 @@ ClpPackedMatrix::transposeTimes(const ClpSimplex * model, double scalar,
                                 CoinIndexedVector * y,
                                 CoinIndexedVector * columnArray) const
 {
+     ClpProfileTimer timer(model->profile(), CLP_PROFILE_TRANSPOSE_TIMES);
      columnArray->clear();
      double * pi = rowArray->denseVector();
      int numberNonZero = 0;
@@ -627,6 +635,12 @@ ClpPackedMatrix::transposeTimes(const ClpSimplex * model, double scalar,
      if (!packed)
           factor *= 0.9;
      assert (!y->getNumElements());
+     // deterministic work - elements of matrix touched
+     if (numberInRowArray > factor * numberRows || !rowCopy)
+          model->addWorkUnits(matrix_->getNumElements());
+     else
+          model->addWorkUnits(numberInRowArray *
+                              (static_cast<double>(matrix_->getNumElements()) / numberRows));
      double multiplierX = 0.8;
      double factor2 = factor * multiplierX;
      if (packed && rowCopy_ && numberInRowArray > 2 && numberInRowArray > factor2 * numberRows &&
@@ -1879,6 +1893,7 @@ ClpPackedMatrix::subsetTransposeTimes(const ClpSimplex * model,
                                       const CoinIndexedVector * y,
                                       CoinIndexedVector * columnArray) const
 {
+     ClpProfileTimer timer(model->profile(), CLP_PROFILE_TRANSPOSE_TIMES);
      columnArray->clear();
      double * COIN_RESTRICT pi = rowArray->denseVector();
      double * COIN_RESTRICT array = columnArray->denseVector();
@@ -1891,6 +1906,10 @@ ClpPackedMatrix::subsetTransposeTimes(const ClpSimplex * model,
      const double * COIN_RESTRICT rowScale = model->rowScale();
      int numberToDo = y->getNumElements();
      const int * COIN_RESTRICT which = y->getIndices();
+     // deterministic work - elements of matrix touched
+     if (numberActiveColumns_)
+          model->addWorkUnits(numberToDo *
+                              (static_cast<double>(matrix_->getNumElements()) / numberActiveColumns_));
      assert (!rowArray->packedMode());
      columnArray->setPacked();
      ClpPackedMatrix * scaledMatrix = model->clpScaledMatrix();
@@ -2054,6 +2073,7 @@ ClpPackedMatrix::transposeTimes2(const ClpSimplex * model,
                                  unsigned int * reference,
                                  double * weights, double scaleFactor)
 {
+     ClpProfileTimer timer(model->profile(), CLP_PROFILE_TRANSPOSE_TIMES);
      // put row of tableau in dj1
      double * pi = pi1->denseVector();
      int numberNonZero = 0;
@@ -2071,6 +2091,8 @@ ClpPackedMatrix::transposeTimes2(const ClpSimplex * model,
      const double * rowScale = model->rowScale();
      assert (!spare->getNumElements());
      assert (numberActiveColumns_ > 0);
+     // deterministic work - elements of matrix touched
+     model->addWorkUnits(matrix_->getNumElements());
      double * piWeight = pi2->denseVector();
      assert (!pi2->packedMode());
      bool killDjs = (scaleFactor == 0.0);
@@ -3261,6 +3283,8 @@ ClpPackedMatrix::scale(ClpModel * model, const ClpSimplex * /*baseModel*/) const
      int numberRows = model->numberRows();
      int numberColumns = matrix_->getNumCols();
      model->setClpScaledMatrix(NULL); // get rid of any scaled matrix
+     // scales are made from scratch
+     numberIncrementallyScaled_ = 0;
      // If empty - return as sanityCheck will trap
      if (!numberRows || !numberColumns) {
           model->setRowScale(NULL);
@@ -3924,6 +3948,88 @@ ClpPackedMatrix::createScaledMatrix(ClpSimplex * model) const
      checkFlags(0);
 #endif
 }
+/* Scales columns from firstColumn on against existing row scales.
+   Returns 1 if new columns fit existing scaling badly */
+int
+ClpPackedMatrix::scaleNewColumns(const ClpModel * model, int firstColumn,
+                                 const double * rowScale, double * columnScale) const
+{
+     int numberColumns = matrix_->getNumCols();
+     int numberNew = numberColumns - firstColumn;
+     if (numberNew <= 0)
+          return 0;
+     /* Scales drift from what a full scale would give as columns are
+        added, so once more than a quarter of columns have been scaled
+        this way since last full scale it is time to start again */
+     int numberIncremental = numberIncrementallyScaled_ + numberNew;
+     if (4 * numberIncremental > numberColumns)
+          return 1;
+     const int * row = matrix_->getIndices();
+     const CoinBigIndex * columnStart = matrix_->getVectorStarts();
+     const int * columnLength = matrix_->getVectorLengths();
+     const double * elementByColumn = matrix_->getElements();
+     const double * columnLower = model->columnLower();
+     const double * columnUpper = model->columnUpper();
+     double * inverseColumnScale = columnScale + numberColumns;
+     int iColumn;
+     /* Sample existing columns to get largest scaled element (final pass
+        makes that same for all columns) and worst ratio within a column */
+     double target = 0.0;
+     double worstRatio = 1.0;
+     int step = CoinMax(1, firstColumn / 100);
+     for (iColumn = 0; iColumn < firstColumn; iColumn += step) {
+          if (columnUpper[iColumn] > columnLower[iColumn] + 1.0e-12 &&
+                    columnLength[iColumn]) {
+               CoinBigIndex j;
+               double largest = 1.0e-20;
+               double smallest = 1.0e50;
+               for (j = columnStart[iColumn];
+                         j < columnStart[iColumn] + columnLength[iColumn]; j++) {
+                    double value = fabs(elementByColumn[j] * rowScale[row[j]]);
+                    largest = CoinMax(largest, value);
+                    smallest = CoinMin(smallest, value);
+               }
+               target = CoinMax(target, largest * columnScale[iColumn]);
+               worstRatio = CoinMin(worstRatio, smallest / largest);
+          }
+     }
+     if (!target)
+          target = 1.0;
+     int numberBad = 0;
+     for (iColumn = firstColumn; iColumn < numberColumns; iColumn++) {
+          double scale = 1.0;
+          if (columnUpper[iColumn] >
+                    columnLower[iColumn] + 1.0e-12) {
+               CoinBigIndex j;
+               double largest = 1.0e-20;
+               double smallest = 1.0e50;
+               for (j = columnStart[iColumn];
+                         j < columnStart[iColumn] + columnLength[iColumn]; j++) {
+                    double value = fabs(elementByColumn[j] * rowScale[row[j]]);
+                    largest = CoinMax(largest, value);
+                    smallest = CoinMin(smallest, value);
+               }
+               if (model->scalingFlag() != 5) {
+                    // as final pass in scale
+                    scale = target / largest;
+                    double difference = columnUpper[iColumn] - columnLower[iColumn];
+                    if (difference < 1.0e-5 * scale)
+                         scale = difference / 1.0e-5;
+               } else if (columnLength[iColumn]) {
+                    scale = 1.0 / sqrt(smallest * largest);
+               }
+               // much worse spread than anything there already
+               if (columnLength[iColumn] && smallest < 1.0e-2 * worstRatio * largest)
+                    numberBad++;
+          }
+          columnScale[iColumn] = scale;
+          inverseColumnScale[iColumn] = 1.0 / scale;
+     }
+     if (numberBad)
+          return 1;
+     numberIncrementallyScaled_ = numberIncremental;
+     return 0;
+}
 /* Unpacks a column into an CoinIndexedvector
  */
 void
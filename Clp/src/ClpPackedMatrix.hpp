@@ -137,6 +137,14 @@ public:
      virtual void scaleRowCopy(ClpModel * model) const ;
      /// Creates scaled column copy if scales exist
      void createScaledMatrix(ClpSimplex * model) const;
+     /** Scales columns from firstColumn on against existing row scales.
+         columnScale has room for scales and inverses of all columns and
+         first firstColumn entries of each half are already set.
+         Returns 1 if new columns fit existing scaling badly or too many
+         columns have been scaled this way since last full scale (so
+         caller should rescale from scratch) */
+     int scaleNewColumns(const ClpModel * model, int firstColumn,
+                         const double * rowScale, double * columnScale) const;
      /** Realy really scales column copy
          Only called if scales already exist.
          Up to user ro delete */
@@ -475,6 +483,8 @@ protected:
          16 - wants special column copy
      */
      mutable int flags_;
+     /// Number of columns scaled by scaleNewColumns since last full scale
+     mutable int numberIncrementallyScaled_;
      /// Special row copy
      ClpPackedMatrix2 * rowCopy_;
      /// Special column copy
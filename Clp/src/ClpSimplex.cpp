@@ -121,6 +121,7 @@ ClpSimplex::ClpSimplex (bool emptyMessages) :
      incomingInfeasibility_(1.0),
      allowedInfeasibility_(10.0),
      automaticScale_(0),
+     profile_(NULL),
      maximumPerturbationSize_(0),
      perturbationArray_(NULL),
      baseModel_(NULL)
@@ -236,6 +237,7 @@ ClpSimplex::ClpSimplex ( const ClpModel * rhs,
      incomingInfeasibility_(1.0),
      allowedInfeasibility_(10.0),
      automaticScale_(0),
+     profile_(NULL),
      maximumPerturbationSize_(0),
      perturbationArray_(NULL),
      baseModel_(NULL)
@@ -388,6 +390,7 @@ ClpSimplex::ClpSimplex ( const ClpSimplex * rhs,
      incomingInfeasibility_(1.0),
      allowedInfeasibility_(10.0),
      automaticScale_(0),
+     profile_(NULL),
      maximumPerturbationSize_(0),
      perturbationArray_(NULL),
      baseModel_(NULL)
@@ -528,6 +531,39 @@ ClpSimplex::~ClpSimplex ()
      delete nonLinearCost_;
 }
 //#############################################################################
+// Zeroes all times and counts
+void
+ClpSimplexProfile::clear()
+{
+     for (int i = 0; i < CLP_PROFILE_NUMBER; i++) {
+          time[i] = 0.0;
+          count[i] = 0;
+     }
+     timed = 0.0;
+}
+// Adds in times and counts from another profile
+void
+ClpSimplexProfile::add(const ClpSimplexProfile & other)
+{
+     for (int i = 0; i < CLP_PROFILE_NUMBER; i++) {
+          time[i] += other.time[i];
+          count[i] += other.count[i];
+     }
+}
+// Name of phase
+const char *
+ClpSimplexProfile::phaseName(int phase)
+{
+     static const char * names[CLP_PROFILE_NUMBER] = {
+          "FTRAN", "BTRAN", "pricing", "ratio test",
+          "transposeTimes", "factorization", "update"
+     };
+     if (phase >= 0 && phase < CLP_PROFILE_NUMBER)
+          return names[phase];
+     else
+          return "unknown";
+}
+//#############################################################################
 void ClpSimplex::setLargeValue( double value)
 {
      if (value > 0.0 && value < COIN_DBL_MAX)
@@ -2198,6 +2234,7 @@ ClpSimplex::ClpSimplex(const ClpSimplex &rhs, int scalingMode) :
      incomingInfeasibility_(1.0),
      allowedInfeasibility_(10.0),
      automaticScale_(0),
+     profile_(NULL),
      maximumPerturbationSize_(0),
      perturbationArray_(NULL),
      baseModel_(NULL)
@@ -2306,6 +2343,7 @@ ClpSimplex::ClpSimplex(const ClpModel &rhs, int scalingMode) :
      incomingInfeasibility_(1.0),
      allowedInfeasibility_(10.0),
      automaticScale_(0),
+     profile_(NULL),
      maximumPerturbationSize_(0),
      perturbationArray_(NULL),
      baseModel_(NULL)
@@ -2501,6 +2539,13 @@ ClpSimplex::gutsOfCopy(const ClpSimplex & rhs)
           maximumPerturbationSize_ = 0;
           perturbationArray_ = NULL;
      }
+     // a copy gets its own (empty) profile
+     if (rhs.profile_) {
+          profile_ = new ClpSimplexProfile;
+          profile_->clear();
+     } else {
+          profile_ = NULL;
+     }
      if (rhs.baseModel_) {
           baseModel_ = new ClpSimplex(*rhs.baseModel_);
      } else {
@@ -2583,6 +2628,8 @@ ClpSimplex::gutsOfDelete(int type)
           delete [] perturbationArray_;
           perturbationArray_ = NULL;
           maximumPerturbationSize_ = 0;
+          delete profile_;
+          profile_ = NULL;
      } else {
           // delete any size information in methods
           if (type > 1) {
@@ -5818,21 +5865,9 @@ int ClpSimplex::primal (int ifValuesPass , int startFinishOptions)
 }
 #ifndef SLIM_CLP
 #include "ClpQuadraticObjective.hpp"
-/* Dual ranging.
-   This computes increase/decrease in cost for each given variable and corresponding
-   sequence numbers which would change basis.  Sequence numbers are 0..numberColumns
-   and numberColumns.. for artificials/slacks.
-   For non-basic variables the sequence number will be that of the non-basic variables.
-
-   Up to user to provide correct length arrays.
-
-   Returns non-zero if infeasible unbounded etc
-*/
-#include "ClpSimplexOther.hpp"
-int ClpSimplex::dualRanging(int numberCheck, const int * which,
-                            double * costIncrease, int * sequenceIncrease,
-                            double * costDecrease, int * sequenceDecrease,
-                            double * valueIncrease, double * valueDecrease)
+/* Gets optimal basis and factorization for ranging.
+   Returns non-zero (after clearing up) if not optimal */
+int ClpSimplex::startRanging()
 {
      int savePerturbation = perturbation_;
      perturbation_ = 100;
@@ -5863,6 +5898,26 @@ int ClpSimplex::dualRanging(int numberCheck, const int * which,
           finish(); // get rid of arrays
           return 1; // odd status
      }
+     return 0;
+}
+/* Dual ranging.
+   This computes increase/decrease in cost for each given variable and corresponding
+   sequence numbers which would change basis.  Sequence numbers are 0..numberColumns
+   and numberColumns.. for artificials/slacks.
+   For non-basic variables the sequence number will be that of the non-basic variables.
+
+   Up to user to provide correct length arrays.
+
+   Returns non-zero if infeasible unbounded etc
+*/
+#include "ClpSimplexOther.hpp"
+int ClpSimplex::dualRanging(int numberCheck, const int * which,
+                            double * costIncrease, int * sequenceIncrease,
+                            double * costDecrease, int * sequenceDecrease,
+                            double * valueIncrease, double * valueDecrease)
+{
+     if (startRanging())
+          return 1; // odd status
      static_cast<ClpSimplexOther *> (this)->dualRanging(numberCheck, which,
                costIncrease, sequenceIncrease,
                costDecrease, sequenceDecrease,
@@ -5884,41 +5939,44 @@ int ClpSimplex::primalRanging(int numberCheck, const int * which,
                               double * valueIncrease, int * sequenceIncrease,
                               double * valueDecrease, int * sequenceDecrease)
 {
-     int savePerturbation = perturbation_;
-     perturbation_ = 100;
-     /*int returnCode =*/ static_cast<ClpSimplexPrimal *> (this)->primal(0, 1);
-     if (problemStatus_ == 10) {
-          //printf("Cleaning up with dual\n");
-          bool denseFactorization = initialDenseFactorization();
-          // It will be safe to allow dense
-          setInitialDenseFactorization(true);
-          // check which algorithms allowed
-          int dummy;
-          if ((matrix_->generalExpanded(this, 4, dummy) & 2) != 0) {
-               // upperOut_ has largest away from bound
-               double saveBound = dualBound_;
-               if (upperOut_ > 0.0)
-                    dualBound_ = 2.0 * upperOut_;
-               /*returnCode =*/ static_cast<ClpSimplexDual *> (this)->dual(0, 1);
-               dualBound_ = saveBound;
-          } else {
-	        /*returnCode =*/ static_cast<ClpSimplexPrimal *> (this)->primal(0, 1);
-          }
-          setInitialDenseFactorization(denseFactorization);
-          if (problemStatus_ == 10)
-               problemStatus_ = 0;
-     }
-     perturbation_ = savePerturbation;
-     if (problemStatus_ || secondaryStatus_ == 6) {
-          finish(); // get rid of arrays
+     if (startRanging())
           return 1; // odd status
-     }
      static_cast<ClpSimplexOther *> (this)->primalRanging(numberCheck, which,
                valueIncrease, sequenceIncrease,
                valueDecrease, sequenceDecrease);
      finish(); // get rid of arrays
      return 0;
 }
+/* Ranging for whole model.
+   Does dual ranging (cost changes) and primal ranging (value changes)
+   for every variable, columns then slacks.  Either set of arrays may be NULL.
+   Work is split over numberThreads copies of the factorized model.
+
+   Returns non-zero if infeasible unbounded etc
+*/
+int ClpSimplex::fullRanging(int numberThreads,
+                            double * costIncrease, int * sequenceIncrease,
+                            double * costDecrease, int * sequenceDecrease,
+                            double * valueIncrease, int * valueSequenceIncrease,
+                            double * valueDecrease, int * valueSequenceDecrease)
+{
+     // each set of four arrays must be all there or all NULL
+     int numberCost = (costIncrease ? 1 : 0) + (sequenceIncrease ? 1 : 0) +
+                      (costDecrease ? 1 : 0) + (sequenceDecrease ? 1 : 0);
+     int numberValue = (valueIncrease ? 1 : 0) + (valueSequenceIncrease ? 1 : 0) +
+                       (valueDecrease ? 1 : 0) + (valueSequenceDecrease ? 1 : 0);
+     if ((numberCost && numberCost < 4) || (numberValue && numberValue < 4))
+          return -1;
+     if (startRanging())
+          return 1; // odd status
+     static_cast<ClpSimplexOther *> (this)->fullRanging(numberThreads,
+               costIncrease, sequenceIncrease,
+               costDecrease, sequenceDecrease,
+               valueIncrease, valueSequenceIncrease,
+               valueDecrease, valueSequenceDecrease);
+     finish(); // get rid of arrays
+     return 0;
+}
 /* Write the basis in MPS format to the specified file.
    If writeValues true writes values of structurals
    (and adds VALUES to end of NAME card)
@@ -5947,6 +6005,18 @@ ClpSimplex::readBasis(const char *filename)
 {
      return static_cast<ClpSimplexOther *> (this)->readBasis(filename);
 }
+// Write basis in compact binary form
+int
+ClpSimplex::writeBinaryBasis(const char *filename) const
+{
+     return static_cast<const ClpSimplexOther *> (this)->writeBinaryBasis(filename);
+}
+// Read a basis written by writeBinaryBasis
+int
+ClpSimplex::readBinaryBasis(const char *filename)
+{
+     return static_cast<ClpSimplexOther *> (this)->readBinaryBasis(filename);
+}
 #include "ClpSimplexNonlinear.hpp"
 /* Solves nonlinear problem using SLP - may be used as crash
    for other algorithms when number of iterations small
@@ -6052,7 +6122,8 @@ ClpSimplex::barrier(bool crossover)
      }
 #else
      if (!doKKT) {
-          ClpCholeskyBase * cholesky = new ClpCholeskyBase();
+          // find dense columns automatically
+          ClpCholeskyBase * cholesky = new ClpCholeskyBase(0);
           barrier.setCholesky(cholesky);
      } else {
           ClpCholeskyBase * cholesky = new ClpCholeskyBase();
@@ -6695,6 +6766,7 @@ ClpSimplex::restoreModel(const char * fileName)
                numberRead = fread(array, lengthNames_ + 1, numberRows_, fp);
                if (numberRead != static_cast<size_t>(numberRows_))
                     return 1;
+               deleteNameHash();
                rowNames_ = std::vector<std::string> ();
                rowNames_.resize(numberRows_);
                for (i = 0; i < numberRows_; i++) {
@@ -7091,6 +7163,15 @@ ClpSimplex::loadProblem (  const CoinPackedMatrix& matrix,
                            rowObjective);
      createStatus();
 }
+// Loads a problem by taking over the arguments
+void
+ClpSimplex::assignProblem (  CoinPackedMatrix *& matrix,
+                             double *& collb, double *& colub, double *& obj,
+                             double *& rowlb, double *& rowub)
+{
+     ClpModel::assignProblem(matrix, collb, colub, obj, rowlb, rowub);
+     createStatus();
+}
 
 /* Just like the other loadProblem() method except that the matrix is
    given in a standard column major ordered format (without gaps). */
@@ -7219,6 +7300,7 @@ ClpSimplex::readLp(const char *filename, const double epsilon )
      createStatus();
      unsigned int maxLength = 0;
      int iRow;
+     deleteNameHash();
      rowNames_ = std::vector<std::string> ();
      columnNames_ = std::vector<std::string> ();
      rowNames_.reserve(numberRows_);
@@ -8315,10 +8397,37 @@ ClpSimplex::setFactorizationFrequency(int value)
      if (factorization_)
           factorization_->maximumPivots(value);
 }
+// Switches timing of phases of iterations on or off
+void
+ClpSimplex::setProfiling(bool onOff)
+{
+     if (onOff) {
+          if (!profile_) {
+               profile_ = new ClpSimplexProfile;
+               profile_->clear();
+          }
+     } else {
+          delete profile_;
+          profile_ = NULL;
+     }
+     if (factorization_)
+          factorization_->setProfile(profile_);
+}
+// Zeroes profile (if profiling)
+void
+ClpSimplex::clearProfile()
+{
+     if (profile_)
+          profile_->clear();
+}
 // Common bits of coding for dual and primal
 int
 ClpSimplex::startup(int ifValuesPass, int startFinishOptions)
 {
+     if (factorization_) {
+          factorization_->setProfile(profile_);
+          factorization_->setWorkCounter(&workUnits_);
+     }
      // Get rid of some arrays and empty factorization
      int useFactorization = false;
      if ((startFinishOptions & 2) != 0 && (whatsChanged_&(2 + 512)) == 2 + 512)
@@ -8815,6 +8924,7 @@ ClpSimplex::ClpSimplex (ClpSimplex * wholeModel,
                         int numberColumns, const int * whichColumns)
 {
 
+     profile_ = NULL;
      // Set up dummy row selection list
      numberRows_ = wholeModel->numberRows_;
      int * whichRow = new int [numberRows_];
@@ -10186,6 +10296,7 @@ ClpSimplex::moveInfo(const ClpSimplex & rhs, bool justStatus)
      numberIterations_ = rhs. numberIterations_;
      problemStatus_ = rhs. problemStatus_;
      secondaryStatus_ = rhs. secondaryStatus_;
+     workUnits_ = rhs.workUnits_;
      if (numberRows_ == rhs.numberRows_ && numberColumns_ == rhs.numberColumns_ && !justStatus) {
           if (rhs.status_) {
                if (status_)
@@ -17,6 +17,7 @@
 #include "ClpMatrixBase.hpp"
 #include "ClpSolve.hpp"
 #include "ClpConfig.h"
+#include "CoinTime.hpp"
 class ClpDualRowPivot;
 class ClpPrimalColumnPivot;
 class ClpFactorization;
@@ -34,6 +35,64 @@ class AbcTolerancesEtc;
 class AbcSimplex;
 #include "CoinAbcCommon.hpp"
 #endif
+/// Phases of simplex iterations timed by ClpSimplexProfile
+enum ClpProfilePhase {
+     CLP_PROFILE_FTRAN = 0,
+     CLP_PROFILE_BTRAN,
+     CLP_PROFILE_PRICING,
+     CLP_PROFILE_RATIO_TEST,
+     CLP_PROFILE_TRANSPOSE_TIMES,
+     CLP_PROFILE_FACTORIZE,
+     CLP_PROFILE_UPDATE,
+     CLP_PROFILE_NUMBER
+};
+/** Wall clock seconds and number of calls for each phase of simplex
+    iterations - see ClpSimplex::setProfiling.
+
+    Times are exclusive - FTRAN done inside pricing is counted as FTRAN
+    and not as pricing.  Only ClpPackedMatrix times transposeTimes.
+*/
+class ClpSimplexProfile {
+public:
+     /// Seconds in each phase
+     double time[CLP_PROFILE_NUMBER];
+     /// Calls of each phase
+     int count[CLP_PROFILE_NUMBER];
+     /// Total of time (so nested phases can be taken out)
+     double timed;
+     /// Zeroes everything
+     void clear();
+     /// Adds in another profile
+     void add(const ClpSimplexProfile & other);
+     /// Name of phase
+     static const char * phaseName(int phase);
+};
+/** Adds time from construction to destruction to one phase of a
+    profile.  Does nothing if profile NULL */
+class ClpProfileTimer {
+public:
+     inline ClpProfileTimer(ClpSimplexProfile * profile, int phase)
+          : profile_(profile), phase_(phase), start_(0.0), timed_(0.0) {
+          if (profile) {
+               start_ = CoinGetTimeOfDay();
+               timed_ = profile->timed;
+          }
+     }
+     inline ~ClpProfileTimer() {
+          if (profile_) {
+               double elapsed = CoinGetTimeOfDay() - start_;
+               // take out phases timed inside this one
+               profile_->time[phase_] += elapsed - (profile_->timed - timed_);
+               profile_->timed = timed_ + elapsed;
+               profile_->count[phase_]++;
+          }
+     }
+private:
+     ClpSimplexProfile * profile_;
+     int phase_;
+     double start_;
+     double timed_;
+};
 /** This solves LPs using the simplex method
 
     It inherits from ClpModel and all its arrays are created at
@@ -180,6 +239,11 @@ public:
                          const double* rowlb, const double* rowub,
                          const double * rowObjective = NULL);
 
+     /** Loads a problem by taking over the arguments instead of copying
+         them - see ClpModel::assignProblem */
+     void assignProblem (  CoinPackedMatrix *& matrix,
+                           double *& collb, double *& colub, double *& obj,
+                           double *& rowlb, double *& rowub);
      /** Just like the other loadProblem() method except that the matrix is
        given in a standard column major ordered format (without gaps). */
      void loadProblem (  const int numcols, const int numrows,
@@ -372,6 +436,22 @@ public:
      int primalRanging(int numberCheck, const int * which,
                        double * valueIncrease, int * sequenceIncrease,
                        double * valueDecrease, int * sequenceDecrease);
+     /** Ranging for whole model.
+         Does dual ranging (as dualRanging - cost changes) and primal ranging
+         (as primalRanging - value changes) for every variable, columns
+         then slacks, straight into arrays of length numberColumns+numberRows.
+         Either set of four arrays may be NULL (but not only some of a set).
+         The variables are split into blocks done in numberThreads threads
+         each with its own copy of the factorized model.
+
+         Returns -1 if a set of arrays is only partly NULL,
+         otherwise non-zero if infeasible unbounded etc
+     */
+     int fullRanging(int numberThreads,
+                     double * costIncrease, int * sequenceIncrease,
+                     double * costDecrease, int * sequenceDecrease,
+                     double * valueIncrease, int * valueSequenceIncrease,
+                     double * valueDecrease, int * valueSequenceDecrease);
      /**
 	Modifies coefficients etc and if necessary pivots in and out.
 	All at same status will be done (basis may go singular).
@@ -442,8 +522,23 @@ public:
                     bool writeValues = false,
                     int formatType = 0) const;
      /** Read a basis from the given filename,
-         returns -1 on file error, 0 if no values, 1 if values */
+         returns -1 on file error, 0 if no values, 1 if values.
+         Files written by writeBinaryBasis are recognized and read
+         with readBinaryBasis. */
      int readBasis(const char *filename);
+     /** Write basis in compact binary form (see
+         CoinWarmStartBasis::writeBinary) - no names or values so much
+         smaller and faster than writeBasis.  Superbasic variables are
+         written as free and fixed ones as at lower bound (as getBasis).
+         Returns non-zero on I/O error
+     */
+     int writeBinaryBasis(const char *filename) const;
+     /** Read a basis written by writeBinaryBasis straight into status
+         array.  Returns 0 if OK, -1 on file error, -2 if not a binary
+         basis file, -3 if corrupt or dimensions do not match model.
+         Activities of nonbasic variables are not changed.
+     */
+     int readBinaryBasis(const char *filename);
      /// Returns a basis (to be deleted by user)
      CoinWarmStartBasis * getBasis() const;
      /// Passes in factorization
@@ -586,6 +681,18 @@ public:
      inline ClpFactorization * factorization() const {
           return factorization_;
      }
+     /** Switches on (true) or off collection of time spent in each
+         phase of simplex iterations.  Switching on zeroes the profile.
+         Time accumulates over solves until clearProfile is called.
+         With presolve the time in the presolved model is added in by
+         initialSolve */
+     void setProfiling(bool onOff);
+     /// Profile - NULL if profiling off
+     inline ClpSimplexProfile * profile() const {
+          return profile_;
+     }
+     /// Zeroes profile (if profiling)
+     void clearProfile();
      /// Sparsity on or off
      bool sparseFactorization() const;
      void setSparseFactorization(bool value);
@@ -819,6 +926,9 @@ protected:
           redoes dual stuff
      */
      double scaleObjective(double value);
+     /** Gets optimal basis and factorization for ranging.
+         Returns non-zero (after clearing up) if not optimal */
+     int startRanging();
      /// Solve using Dantzig-Wolfe decomposition and maybe in parallel
      int solveDW(CoinStructuredModel * model);
      /// Solve using Benders decomposition and maybe in parallel
@@ -1646,6 +1756,8 @@ protected:
      double allowedInfeasibility_;
      /// Automatic scaling of objective and rhs and bounds
      int automaticScale_;
+     /// Time in phases of iterations - NULL if not profiling
+     ClpSimplexProfile * profile_;
      /// Maximum perturbation array size (take out when code rewritten)
      int maximumPerturbationSize_;
      /// Perturbation array (maximumPerturbationSize_)
@@ -2609,6 +2609,8 @@ ClpSimplexDual::updateDualsInValuesPass(CoinIndexedVector * rowArray,
 void
 ClpSimplexDual::dualRow(int alreadyChosen)
 {
+     ClpProfileTimer timer(profile_, CLP_PROFILE_PRICING);
+     addWorkUnits(numberRows_);
      // get pivot row using whichever method it is
      int chosenRow = -1;
 #ifdef FORCE_FOLLOW
@@ -3274,6 +3276,8 @@ ClpSimplexDual::dualColumn(CoinIndexedVector * rowArray,
                            double acceptablePivot,
                            CoinBigIndex * /*dubiousWeights*/)
 {
+     ClpProfileTimer timer(profile_, CLP_PROFILE_RATIO_TEST);
+     addWorkUnits(rowArray->getNumElements() + columnArray->getNumElements());
      int numberPossiblySwapped = 0;
      int numberRemaining = 0;
 
@@ -21,6 +21,7 @@
 #include "CoinIndexedVector.hpp"
 #include "CoinBuild.hpp"
 #include "CoinMpsIO.hpp"
+#include "CoinWarmStartBasis.hpp"
 #include "CoinFloatEqual.hpp"
 #include "ClpMessage.hpp"
 #include <cfloat>
@@ -28,6 +29,10 @@
 #include <string>
 #include <stdio.h>
 #include <iostream>
+#if !defined(_MSC_VER) && !defined(CLP_NO_THREADS)
+#define CLP_OTHER_THREADS
+#include <pthread.h>
+#endif
 #ifdef INT_IS_8
 #define COIN_ANY_BITS_PER_INT 64
 #define COIN_ANY_SHIFT_PER_INT 6
@@ -454,6 +459,254 @@ ClpSimplexOther::primalRanging(int numberCheck, const int * which,
           sequenceDecreased[i] = sequenceDecrease;
      }
 }
+// Offset into array which may be NULL
+template <class T> static inline T * offsetArray(T * array, int offset)
+{
+     return array ? array + offset : NULL;
+}
+// Information for one block of fullRanging
+typedef struct {
+     ClpSimplexOther * model;
+     const int * which;
+     int numberCheck;
+     double * costIncrease;
+     int * sequenceIncrease;
+     double * costDecrease;
+     int * sequenceDecrease;
+     double * valueIncrease;
+     int * valueSequenceIncrease;
+     double * valueDecrease;
+     int * valueSequenceDecrease;
+} ClpRangingBlock;
+static void * clpRangingBlock(void * voidInfo)
+{
+     ClpRangingBlock * block = reinterpret_cast<ClpRangingBlock *>(voidInfo);
+     // sets are all or nothing (checked in ClpSimplex::fullRanging)
+     if (block->costIncrease)
+          block->model->dualRanging(block->numberCheck, block->which,
+                                    block->costIncrease, block->sequenceIncrease,
+                                    block->costDecrease, block->sequenceDecrease);
+     if (block->valueIncrease)
+          block->model->primalRanging(block->numberCheck, block->which,
+                                      block->valueIncrease, block->valueSequenceIncrease,
+                                      block->valueDecrease, block->valueSequenceDecrease);
+     return NULL;
+}
+/* Dual and primal ranging for all variables (columns then slacks).
+   Either set of four arrays may be NULL.
+   Variables are split into blocks and blocks after the first are done
+   on copies of this model in their own threads.
+*/
+void
+ClpSimplexOther::fullRanging(int numberThreads,
+                             double * costIncrease, int * sequenceIncrease,
+                             double * costDecrease, int * sequenceDecrease,
+                             double * valueIncrease, int * valueSequenceIncrease,
+                             double * valueDecrease, int * valueSequenceDecrease)
+{
+     int numberTotal = numberRows_ + numberColumns_;
+     int * which = new int [numberTotal];
+     for (int i = 0; i < numberTotal; i++)
+          which[i] = i;
+#ifndef CLP_OTHER_THREADS
+     numberThreads = 1;
+#endif
+     // not worth a copy for small blocks
+     numberThreads = CoinMax(1, CoinMin(numberThreads, numberTotal / 100));
+     ClpRangingBlock * blocks = new ClpRangingBlock [numberThreads];
+     int start = 0;
+     for (int iThread = 0; iThread < numberThreads; iThread++) {
+          ClpRangingBlock & block = blocks[iThread];
+          int end = (iThread < numberThreads - 1) ?
+                    start + numberTotal / numberThreads : numberTotal;
+          // copy has factorization and work arrays
+          block.model = iThread ?
+                        static_cast<ClpSimplexOther *>(new ClpSimplex(*this)) : this;
+          block.which = which + start;
+          block.numberCheck = end - start;
+          block.costIncrease = offsetArray(costIncrease, start);
+          block.sequenceIncrease = offsetArray(sequenceIncrease, start);
+          block.costDecrease = offsetArray(costDecrease, start);
+          block.sequenceDecrease = offsetArray(sequenceDecrease, start);
+          block.valueIncrease = offsetArray(valueIncrease, start);
+          block.valueSequenceIncrease = offsetArray(valueSequenceIncrease, start);
+          block.valueDecrease = offsetArray(valueDecrease, start);
+          block.valueSequenceDecrease = offsetArray(valueSequenceDecrease, start);
+          start = end;
+     }
+#ifdef CLP_OTHER_THREADS
+     if (numberThreads > 1) {
+          pthread_t * threadId = new pthread_t [numberThreads];
+          char * started = new char [numberThreads];
+          for (int iThread = 1; iThread < numberThreads; iThread++)
+               started[iThread] = pthread_create(threadId + iThread, NULL, clpRangingBlock,
+                                                 blocks + iThread) ? 0 : 1;
+          clpRangingBlock(blocks);
+          for (int iThread = 1; iThread < numberThreads; iThread++) {
+               if (started[iThread])
+                    pthread_join(threadId[iThread], NULL);
+               else
+                    clpRangingBlock(blocks + iThread);
+          }
+          delete [] started;
+          delete [] threadId;
+     } else {
+          clpRangingBlock(blocks);
+     }
+#else
+     clpRangingBlock(blocks);
+#endif
+     for (int iThread = 1; iThread < numberThreads; iThread++)
+          delete static_cast<ClpSimplex *>(blocks[iThread].model);
+     delete [] blocks;
+     delete [] which;
+}
+// Information for one block of solveVariants
+typedef struct {
+     ClpSimplex * model;
+     const ClpSimplex * original;
+     int start;
+     int end;
+     const double * const * arrays[5];
+     double * const * columnSolution;
+     double * objectiveValue;
+     int * status;
+     int numberNotOptimal;
+} ClpVariantBlock;
+static void * clpVariantBlock(void * voidInfo)
+{
+     ClpVariantBlock * block = reinterpret_cast<ClpVariantBlock *>(voidInfo);
+     ClpSimplex * model = block->model;
+     const ClpSimplex * original = block->original;
+     int numberRows = model->numberRows();
+     int numberColumns = model->numberColumns();
+     // setters keep work arrays up to date so dual can skip initialization
+     void (ClpSimplex::*setValue[5])(int, double) = {
+          &ClpSimplex::setColumnLower, &ClpSimplex::setColumnUpper,
+          &ClpSimplex::setObjectiveCoefficient,
+          &ClpSimplex::setRowLower, &ClpSimplex::setRowUpper
+     };
+     const double * originalArray[5] = {
+          original->columnLower(), original->columnUpper(),
+          original->objective(), original->rowLower(), original->rowUpper()
+     };
+     int number[5] = {numberColumns, numberColumns, numberColumns,
+                      numberRows, numberRows
+                     };
+     int numberTotal = numberRows + numberColumns;
+     // arrays in model - no need to look at them again if same
+     const double * current[5];
+     CoinMemcpyN(originalArray, 5, current);
+     block->numberNotOptimal = 0;
+     for (int iVariant = block->start; iVariant < block->end; iVariant++) {
+          for (int iArray = 0; iArray < 5; iArray++) {
+               const double * const * arrays = block->arrays[iArray];
+               const double * array = (arrays && arrays[iVariant]) ?
+                                      arrays[iVariant] : originalArray[iArray];
+               if (array != current[iArray]) {
+                    for (int i = 0; i < number[iArray]; i++)
+                         (model->*setValue[iArray])(i, array[i]);
+                    current[iArray] = array;
+               }
+          }
+          if (model->numberIterations() && original->statusArray()) {
+               // basis of original is usually closer than that of last variant
+               CoinMemcpyN(original->statusArray(), numberTotal, model->statusArray());
+               CoinMemcpyN(original->primalColumnSolution(), numberColumns,
+                           model->primalColumnSolution());
+               CoinMemcpyN(original->primalRowSolution(), numberRows,
+                           model->primalRowSolution());
+               model->setWhatsChanged(model->whatsChanged() & ~BASIS_SAME);
+          }
+          // first time work areas created, after that kept
+          model->dual(0, (model->whatsChanged() & 1) != 0 ? 7 : 1);
+          int problemStatus = model->problemStatus();
+          if (problemStatus)
+               block->numberNotOptimal++;
+          if (block->columnSolution && block->columnSolution[iVariant])
+               CoinMemcpyN(model->primalColumnSolution(), numberColumns,
+                           block->columnSolution[iVariant]);
+          if (block->objectiveValue)
+               block->objectiveValue[iVariant] = model->objectiveValue();
+          if (block->status)
+               block->status[iVariant] = problemStatus;
+     }
+     return NULL;
+}
+/* Solves numberVariants problems which differ from this model only
+   in bounds and objective.  Each block of variants is solved on one
+   copy of this model kept for whole block.
+*/
+int
+ClpSimplexOther::solveVariants(int numberVariants, int numberThreads,
+                               const double * const * columnLower,
+                               const double * const * columnUpper,
+                               const double * const * objective,
+                               const double * const * rowLower,
+                               const double * const * rowUpper,
+                               double * const * columnSolution,
+                               double * objectiveValue, int * status)
+{
+     if (numberVariants <= 0)
+          return 0;
+#ifndef CLP_OTHER_THREADS
+     numberThreads = 1;
+#endif
+     numberThreads = CoinMax(1, CoinMin(numberThreads, numberVariants));
+     ClpVariantBlock * blocks = new ClpVariantBlock [numberThreads];
+     int start = 0;
+     for (int iThread = 0; iThread < numberThreads; iThread++) {
+          ClpVariantBlock & block = blocks[iThread];
+          int end = (iThread < numberThreads - 1) ?
+                    start + numberVariants / numberThreads : numberVariants;
+          block.model = new ClpSimplex(*this);
+#ifdef CLP_MULTIPLE_FACTORIZATIONS
+          // dense (or small) factorization if thresholds set in this model
+          block.model->factorization()->goDenseOrSmall(numberRows_);
+#endif
+          block.original = this;
+          block.start = start;
+          block.end = end;
+          block.arrays[0] = columnLower;
+          block.arrays[1] = columnUpper;
+          block.arrays[2] = objective;
+          block.arrays[3] = rowLower;
+          block.arrays[4] = rowUpper;
+          block.columnSolution = columnSolution;
+          block.objectiveValue = objectiveValue;
+          block.status = status;
+          start = end;
+     }
+#ifdef CLP_OTHER_THREADS
+     if (numberThreads > 1) {
+          pthread_t * threadId = new pthread_t [numberThreads];
+          char * started = new char [numberThreads];
+          for (int iThread = 1; iThread < numberThreads; iThread++)
+               started[iThread] = pthread_create(threadId + iThread, NULL, clpVariantBlock,
+                                                 blocks + iThread) ? 0 : 1;
+          clpVariantBlock(blocks);
+          for (int iThread = 1; iThread < numberThreads; iThread++) {
+               if (started[iThread])
+                    pthread_join(threadId[iThread], NULL);
+               else
+                    clpVariantBlock(blocks + iThread);
+          }
+          delete [] started;
+          delete [] threadId;
+     } else {
+          clpVariantBlock(blocks);
+     }
+#else
+     clpVariantBlock(blocks);
+#endif
+     int numberNotOptimal = 0;
+     for (int iThread = 0; iThread < numberThreads; iThread++) {
+          numberNotOptimal += blocks[iThread].numberNotOptimal;
+          delete blocks[iThread].model;
+     }
+     delete [] blocks;
+     return numberNotOptimal;
+}
 // Returns new value of whichOther when whichIn enters basis
 double
 ClpSimplexOther::primalRanging1(int whichIn, int whichOther)
@@ -730,6 +983,17 @@ ClpSimplexOther::writeBasis(const char *filename,
      fclose(fp);
      return 0;
 }
+// Looks up names in basis file with name hash of model
+class ClpBasisNameIndex : public CoinMpsNameIndex {
+public:
+     ClpBasisNameIndex(const ClpModel * model)
+          : model_(model) {}
+     virtual int index(const char * name, int which) const {
+          return which ? model_->columnIndex(name) : model_->rowIndex(name);
+     }
+private:
+     const ClpModel * model_;
+};
 // Read a basis from the given filename
 int
 ClpSimplexOther::readBasis(const char *fileName)
@@ -745,17 +1009,34 @@ ClpSimplexOther::readBasis(const char *fileName)
                          << fileName << CoinMessageEol;
                return -1;
           }
+          // See if binary
+          status = readBinaryBasis(fileName);
+          if (status == -3) {
+               handler_->message(CLP_GENERAL, messages_)
+                         << "Binary basis file is corrupt or does not match model"
+                         << CoinMessageEol;
+               return -1;
+          }
+     } else {
+          status = -2;
+     }
+     if (status == -2) {
+          CoinMpsIO m;
+          m.passInMessageHandler(handler_);
+          *m.messagesPointer() = coinMessages();
+          bool savePrefix = m.messageHandler()->prefix();
+          m.messageHandler()->setPrefix(handler_->prefix());
+          // look up names with hash of model (kept if hashing was on)
+          bool saveHashing = nameHashing();
+          setNameHashing(true);
+          ClpBasisNameIndex nameIndex(this);
+          status = m.readBasis(fileName, "", columnActivity_, status_ + numberColumns_,
+                               status_,
+                               columnNames_, numberColumns_,
+                               rowNames_, numberRows_, &nameIndex);
+          setNameHashing(saveHashing);
+          m.messageHandler()->setPrefix(savePrefix);
      }
-     CoinMpsIO m;
-     m.passInMessageHandler(handler_);
-     *m.messagesPointer() = coinMessages();
-     bool savePrefix = m.messageHandler()->prefix();
-     m.messageHandler()->setPrefix(handler_->prefix());
-     status = m.readBasis(fileName, "", columnActivity_, status_ + numberColumns_,
-                          status_,
-                          columnNames_, numberColumns_,
-                          rowNames_, numberRows_);
-     m.messageHandler()->setPrefix(savePrefix);
      if (status >= 0) {
           if (!status) {
                // set values
@@ -783,6 +1064,45 @@ ClpSimplexOther::readBasis(const char *fileName)
      }
      return status;
 }
+// Write basis in compact binary form
+int
+ClpSimplexOther::writeBinaryBasis(const char *filename) const
+{
+     CoinWarmStartBasis * basis = getBasis();
+     int returnCode = basis->writeBinary(filename);
+     delete basis;
+     return returnCode;
+}
+// Read a basis written by writeBinaryBasis
+int
+ClpSimplexOther::readBinaryBasis(const char *filename)
+{
+     CoinWarmStartBasis basis;
+     int returnCode = basis.readBinary(filename);
+     if (returnCode)
+          return returnCode;
+     if (basis.getNumStructural() != numberColumns_ ||
+               basis.getNumArtificial() != numberRows_)
+          return -3;
+     if (!status_) {
+          status_ = new unsigned char [numberColumns_+numberRows_];
+          memset(status_, 0, (numberColumns_ + numberRows_)*sizeof(char));
+     }
+     // Straight from packed arrays - flip slacks back (see getBasis)
+     const char * structural = basis.getStructuralStatus();
+     for (int iColumn = 0; iColumn < numberColumns_; iColumn++) {
+          int iStatus = (structural[iColumn>>2] >> ((iColumn & 3) << 1)) & 3;
+          status_[iColumn] = static_cast<unsigned char>((status_[iColumn] & ~7) | iStatus);
+     }
+     const unsigned char lookupA[] = {isFree, basic, atLowerBound, atUpperBound};
+     const char * artificial = basis.getArtificialStatus();
+     unsigned char * rowStatus = status_ + numberColumns_;
+     for (int iRow = 0; iRow < numberRows_; iRow++) {
+          int iStatus = (artificial[iRow>>2] >> ((iRow & 3) << 1)) & 3;
+          rowStatus[iRow] = static_cast<unsigned char>((rowStatus[iRow] & ~7) | lookupA[iStatus]);
+     }
+     return 0;
+}
 /* Creates dual of a problem if looks plausible
    (defaults will always create model)
    fractionRowRanges is fraction of rows allowed to have ranges
@@ -2049,6 +2369,7 @@ ClpSimplexOther::parametrics(double startingTheta, double & endingTheta, double
                while (!returnCode) {
 		    //assert (reportIncrement);
 		 parametricsData paramData;
+		 paramData.points = NULL;
 		 paramData.startingTheta=startingTheta;
 		 paramData.endingTheta=endingTheta;
 		 paramData.maxTheta=COIN_DBL_MAX;
@@ -2713,6 +3034,213 @@ ClpSimplexOther::parametrics(const char * dataFile)
   fclose(fp);
   return returnCode;
 }
+// Adds breakpoint to points (unless same theta as last)
+static void addParametricsPoint(ClpParametricsPoints & points,
+                                double theta, double objective)
+{
+     if (points.numberPoints &&
+               fabs(theta - points.theta[points.numberPoints-1]) <= 1.0e-12 * (1.0 + fabs(theta)))
+          return;
+     if (points.numberPoints == points.maximumPoints) {
+          points.maximumPoints = 2 * points.maximumPoints + 10;
+          double * temp = new double [points.maximumPoints];
+          CoinMemcpyN(points.theta, points.numberPoints, temp);
+          delete [] points.theta;
+          points.theta = temp;
+          temp = new double [points.maximumPoints];
+          CoinMemcpyN(points.objective, points.numberPoints, temp);
+          delete [] points.objective;
+          points.objective = temp;
+     }
+     points.theta[points.numberPoints] = theta;
+     points.objective[points.numberPoints++] = objective;
+}
+// Reports breakpoint at theta and records it if paramData.points
+void
+ClpSimplexOther::reportBreakpoint(parametricsData & paramData, double theta)
+{
+     handler_->message(CLP_PARAMETRICS_STATS, messages_)
+          << theta << objectiveValue() << CoinMessageEol;
+     if (paramData.points)
+          addParametricsPoint(*paramData.points, theta, objectiveValue());
+}
+// Information for one segment of parametricsParallel
+typedef struct {
+     ClpSimplex * model;
+     ClpParametricsPoints points;
+     double startingTheta;
+     double endingTheta;
+     const double * changeLowerBound;
+     const double * changeUpperBound;
+     const double * changeLowerRhs;
+     const double * changeUpperRhs;
+     int returnCode;
+} ClpParametricsSegment;
+// Does segments first, first+stride ...
+typedef struct {
+     ClpParametricsSegment * segments;
+     int first;
+     int stride;
+     int numberSegments;
+} ClpParametricsWork;
+static void * clpParametricsSegments(void * voidInfo)
+{
+     ClpParametricsWork * work = reinterpret_cast<ClpParametricsWork *>(voidInfo);
+     for (int i = work->first; i < work->numberSegments; i += work->stride) {
+          ClpParametricsSegment & segment = work->segments[i];
+          double endingTheta = segment.endingTheta;
+          segment.returnCode = static_cast<ClpSimplexOther *>(segment.model)->
+                               parametrics(segment.startingTheta, endingTheta,
+                                           segment.changeLowerBound, segment.changeUpperBound,
+                                           segment.changeLowerRhs, segment.changeUpperRhs,
+                                           &segment.points);
+          if (!segment.returnCode && endingTheta < segment.endingTheta)
+               segment.returnCode = 1;
+          segment.endingTheta = endingTheta;
+     }
+     return NULL;
+}
+/* Parametrics in segments.
+   The range startingTheta to endingTheta is cut into numberSegments
+   equal pieces.  Each piece is done by the bounds/rhs version of
+   parametrics on a copy of this model warm started from the current
+   basis - using up to numberThreads threads.  The breakpoints
+   (theta and objective) are then merged into one list in theta order
+   and passed to callback if not NULL once all segments are done.
+   Only the copies are changed and scaling is switched off in them.
+   Return code is as parametrics for first segment which failed
+   (points up to there are still passed) - so 0 if all went well.
+*/
+int
+ClpSimplexOther::parametricsParallel(double startingTheta, double endingTheta,
+                                     int numberSegments, int numberThreads,
+                                     const double * changeLowerBound, const double * changeUpperBound,
+                                     const double * changeLowerRhs, const double * changeUpperRhs,
+                                     ClpParametricsCallback callback, void * userData)
+{
+     if (endingTheta < startingTheta)
+          return -2;
+     numberSegments = CoinMax(numberSegments, 1);
+     if (endingTheta == startingTheta)
+          numberSegments = 1;
+     numberThreads = CoinMax(CoinMin(numberThreads, numberSegments), 1);
+     ClpParametricsSegment * segments = new ClpParametricsSegment [numberSegments];
+     double step = (endingTheta - startingTheta) / numberSegments;
+     int iSegment;
+     for (iSegment = 0; iSegment < numberSegments; iSegment++) {
+          ClpParametricsSegment & segment = segments[iSegment];
+          // copy has same basis so is warm started
+          segment.model = new ClpSimplex(*this);
+          segment.model->scaling(0);
+          // own quiet handler as copy may share a user handler
+          segment.model->setDefaultMessageHandler();
+          segment.model->setLogLevel(0);
+          segment.points.theta = NULL;
+          segment.points.objective = NULL;
+          segment.points.numberPoints = 0;
+          segment.points.maximumPoints = 0;
+          segment.startingTheta = startingTheta + iSegment * step;
+          segment.endingTheta = (iSegment < numberSegments - 1) ?
+                                startingTheta + (iSegment + 1) * step : endingTheta;
+          segment.changeLowerBound = changeLowerBound;
+          segment.changeUpperBound = changeUpperBound;
+          segment.changeLowerRhs = changeLowerRhs;
+          segment.changeUpperRhs = changeUpperRhs;
+          segment.returnCode = 0;
+     }
+     ClpParametricsWork * work = new ClpParametricsWork [numberThreads];
+     for (int iThread = 0; iThread < numberThreads; iThread++) {
+          work[iThread].segments = segments;
+          work[iThread].first = iThread;
+          work[iThread].stride = numberThreads;
+          work[iThread].numberSegments = numberSegments;
+     }
+#ifdef CLP_OTHER_THREADS
+     if (numberThreads > 1) {
+          pthread_t * threadId = new pthread_t [numberThreads];
+          int numberStarted = 0;
+          for (int iThread = 1; iThread < numberThreads; iThread++) {
+               if (pthread_create(threadId + iThread, NULL, clpParametricsSegments,
+                                  work + iThread))
+                    break;
+               numberStarted++;
+          }
+          clpParametricsSegments(work);
+          for (int iThread = 1; iThread <= numberStarted; iThread++)
+               pthread_join(threadId[iThread], NULL);
+          // any not started are done here
+          for (int iThread = numberStarted + 1; iThread < numberThreads; iThread++)
+               clpParametricsSegments(work + iThread);
+          delete [] threadId;
+     } else {
+          clpParametricsSegments(work);
+     }
+#else
+     work[0].stride = 1;
+     clpParametricsSegments(work);
+#endif
+     // Merge - segments join at end points so drop repeats
+     ClpParametricsPoints merged = {NULL, NULL, 0, 0};
+     int returnCode = 0;
+     double lastTheta = -COIN_DBL_MAX;
+     for (iSegment = 0; iSegment < numberSegments; iSegment++) {
+          ClpParametricsSegment & segment = segments[iSegment];
+          const ClpParametricsPoints & points = segment.points;
+          for (int i = 0; i < points.numberPoints; i++) {
+               double theta = points.theta[i];
+               if (theta <= lastTheta + 1.0e-12 * (1.0 + fabs(theta)))
+                    continue;
+               lastTheta = theta;
+               addParametricsPoint(merged, theta, points.objective[i]);
+          }
+          if (segment.returnCode) {
+               returnCode = segment.returnCode;
+               break;
+          }
+     }
+     /* Start of a later segment is not a breakpoint unless slope changes
+        there - so drop if in line with neighbours */
+     int numberPoints = 0;
+     double * theta = merged.theta;
+     double * objective = merged.objective;
+     for (int i = 0; i < merged.numberPoints; i++) {
+          bool keep = true;
+          if (numberPoints && i < merged.numberPoints - 1) {
+               for (iSegment = 1; iSegment < numberSegments; iSegment++) {
+                    if (theta[i] == segments[iSegment].startingTheta)
+                         break;
+               }
+               if (iSegment < numberSegments) {
+                    double slope1 = (objective[i] - objective[numberPoints-1]) /
+                                    (theta[i] - theta[numberPoints-1]);
+                    double slope2 = (objective[i+1] - objective[i]) /
+                                    (theta[i+1] - theta[i]);
+                    if (fabs(slope1 - slope2) <= 1.0e-9 * (1.0 + fabs(slope1)))
+                         keep = false;
+               }
+          }
+          if (keep) {
+               theta[numberPoints] = theta[i];
+               objective[numberPoints++] = objective[i];
+          }
+     }
+     if (callback) {
+          for (int i = 0; i < numberPoints; i++) {
+               if (callback(theta[i], objective[i], userData))
+                    break;
+          }
+     }
+     for (iSegment = 0; iSegment < numberSegments; iSegment++) {
+          delete segments[iSegment].model;
+          delete [] segments[iSegment].points.theta;
+          delete [] segments[iSegment].points.objective;
+     }
+     delete [] merged.theta;
+     delete [] merged.objective;
+     delete [] segments;
+     delete [] work;
+     return returnCode;
+}
 int
 ClpSimplexOther::parametricsLoop(parametricsData & paramData,double reportIncrement,
                                  const double * lowerChange, const double * upperChange,
@@ -2843,7 +3371,8 @@ ClpSimplexOther::parametricsLoop(parametricsData & paramData,double reportIncrem
 int
 ClpSimplexOther::parametrics(double startingTheta, double & endingTheta,
                              const double * lowerChangeBound, const double * upperChangeBound,
-                             const double * lowerChangeRhs, const double * upperChangeRhs)
+                             const double * lowerChangeRhs, const double * upperChangeRhs,
+                             ClpParametricsPoints * points)
 {
   int savePerturbation = perturbation_;
   perturbation_ = 102; // switch off
@@ -2889,6 +3418,7 @@ ClpSimplexOther::parametrics(double startingTheta, double & endingTheta,
   //memset(markDone,0,numberTotal);
   int * backwardBasic = upperActive+numberTotal;
   parametricsData paramData;
+  paramData.points = points;
   paramData.lowerChange = lowerChange;
   paramData.lowerList=lowerList;
   paramData.upperChange = upperChange;
@@ -3080,8 +3610,7 @@ ClpSimplexOther::parametrics(double startingTheta, double & endingTheta,
 	  //for (int i=0;i<numberRows_+numberColumns_;i++)
 	  //setFakeBound(i, noFake);
 	  // Now do parametrics
-	  handler_->message(CLP_PARAMETRICS_STATS, messages_)
-	    << startingTheta << objectiveValue() << CoinMessageEol;
+	  reportBreakpoint(paramData, startingTheta);
 	  bool canSkipFactorization=true;
 	  while (!returnCode) {
 	    paramData.startingTheta=startingTheta;
@@ -3094,8 +3623,7 @@ ClpSimplexOther::parametrics(double startingTheta, double & endingTheta,
 	    if (!returnCode) {
 	      //startingTheta = endingTheta;
 	      //endingTheta = saveEndingTheta;
-	      handler_->message(CLP_PARAMETRICS_STATS, messages_)
-		<< startingTheta << objectiveValue() << CoinMessageEol;
+	      reportBreakpoint(paramData, startingTheta);
 	      if (startingTheta >= endingTheta-primalTolerance_
 		  ||problemStatus_==2)
 		break;
@@ -3104,8 +3632,7 @@ ClpSimplexOther::parametrics(double startingTheta, double & endingTheta,
 	      abort(); //needToDoSomething = true;
 	    } else if (problemStatus_==1) {
 	      // can't move any further
-	      handler_->message(CLP_PARAMETRICS_STATS, messages_)
-		<< endingTheta << objectiveValue() << CoinMessageEol;
+	      reportBreakpoint(paramData, endingTheta);
 	      problemStatus_=0;
 	    }
 	  }
@@ -3659,8 +4186,7 @@ ClpSimplexOther::whileIterating(parametricsData & paramData, double /*reportIncr
 	  sequenceIn_=-1;
           if (pivotType) {
 	    if (useTheta>lastTheta+1.0e-9) {
-	      handler_->message(CLP_PARAMETRICS_STATS, messages_)
-		<< useTheta << objectiveValue() << CoinMessageEol;
+	      reportBreakpoint(paramData, useTheta);
 	      lastTheta = useTheta;
 	    }
 	    problemStatus_ = -2;
@@ -4150,10 +4676,11 @@ ClpSimplexOther::whileIterating(parametricsData & paramData, double /*reportIncr
 		      handler_->message(CLP_PARAMETRICS_STATS2, messages_)
 			<< useTheta << objectiveValue() 
 			<< in << out << CoinMessageEol;
+		      if (paramData.points)
+			addParametricsPoint(*paramData.points, useTheta, objectiveValue());
 		    }
 		    if (useTheta>lastTheta+1.0e-9) {
-		      handler_->message(CLP_PARAMETRICS_STATS, messages_)
-			<< useTheta << objectiveValue() << CoinMessageEol;
+		      reportBreakpoint(paramData, useTheta);
 		      lastTheta = useTheta;
 		    }
                     // and set bounds correctly
@@ -13,6 +13,25 @@
 
 #include "ClpSimplex.hpp"
 
+/** Callback used by ClpSimplexOther::parametricsParallel.
+    Called once for each breakpoint in increasing theta with theta,
+    objective value at theta and user pointer.
+    Return non-zero to stop any more calls.
+    Calls are made in the calling thread after all segments are done
+    (results are not streamed as segments finish).
+*/
+typedef int (*ClpParametricsCallback)(double theta, double objectiveValue,
+                                      void * userData);
+/** Breakpoints (theta and objective) recorded by ClpSimplexOther::parametrics.
+    Start with all zero - arrays are grown with new [] and owner deletes them.
+*/
+typedef struct {
+     double * theta;
+     double * objective;
+     int numberPoints;
+     int maximumPoints;
+} ClpParametricsPoints;
+
 /** This is for Simplex stuff which is neither dual nor primal
 
     It inherits from ClpSimplex.  It has no data of its own and
@@ -67,6 +86,18 @@ public:
      void primalRanging(int numberCheck, const int * which,
                         double * valueIncrease, int * sequenceIncrease,
                         double * valueDecrease, int * sequenceDecrease);
+     /** Dual and primal ranging for all variables (columns then slacks).
+         Either set of four arrays may be NULL (a whole set - not part).
+         Variables are split into blocks and blocks after the first are done
+         on copies of this model in their own threads.
+
+         When here - guaranteed optimal
+     */
+     void fullRanging(int numberThreads,
+                      double * costIncrease, int * sequenceIncrease,
+                      double * costDecrease, int * sequenceDecrease,
+                      double * valueIncrease, int * valueSequenceIncrease,
+                      double * valueDecrease, int * valueSequenceDecrease);
      /** Parametrics
          This is an initial slow version.
          The code uses current bounds + theta * change (if change array not NULL)
@@ -96,12 +127,53 @@ public:
          2 for unbounded, if error on ranges -1,  otherwise 0.
          Event handler may do more
          On exit endingTheta is maximum reached (can be used for next startingTheta)
+         If points not NULL each breakpoint reported is also added to it.
      */
      int parametrics(double startingTheta, double & endingTheta, 
                      const double * changeLowerBound, const double * changeUpperBound,
-                     const double * changeLowerRhs, const double * changeUpperRhs);
+                     const double * changeLowerRhs, const double * changeUpperRhs,
+                     ClpParametricsPoints * points = NULL);
      int parametricsObj(double startingTheta, double & endingTheta, 
 			const double * changeObjective);
+     /** Parametrics in segments.
+         The range startingTheta to endingTheta is cut into numberSegments
+         equal pieces.  Each piece is done by the bounds/rhs version of
+         parametrics on a copy of this model warm started from the current
+         basis - using up to numberThreads threads.  The breakpoints
+         (theta and objective) are then merged into one list in theta order
+         and passed to callback if not NULL once all segments are done.
+         Only the copies are changed and scaling is switched off in them.
+         Return code is as parametrics for first segment which failed
+         (points up to there are still passed) - so 0 if all went well.
+     */
+     int parametricsParallel(double startingTheta, double endingTheta,
+                             int numberSegments, int numberThreads,
+                             const double * changeLowerBound, const double * changeUpperBound,
+                             const double * changeLowerRhs, const double * changeUpperRhs,
+                             ClpParametricsCallback callback, void * userData);
+     /** Solves numberVariants problems which differ from this model only
+         in bounds and objective - meant for many small problems.
+         For variant i bounds and objective are taken from columnLower[i] etc,
+         if an array of arrays or an entry is NULL that of this model is used.
+         Variants are split into blocks, one for each of up to numberThreads
+         threads.  Each block is solved on one copy of this model which keeps
+         its work areas and factorization (going dense or small if thresholds
+         are set in factorization of this model).  Each variant is solved by
+         dual starting from basis of this model - or that of previous variant
+         if that needed no iterations - so this model should be optimal.
+         This model is not changed.
+         If not NULL columnSolution[i] (numberColumns), objectiveValue[i] and
+         status[i] (as problemStatus) are filled in for each variant.
+         Returns number of variants not proven optimal.
+     */
+     int solveVariants(int numberVariants, int numberThreads,
+                       const double * const * columnLower,
+                       const double * const * columnUpper,
+                       const double * const * objective,
+                       const double * const * rowLower,
+                       const double * const * rowUpper,
+                       double * const * columnSolution,
+                       double * objectiveValue, int * status);
     /// Finds best possible pivot
     double bestPivot(bool justColumns=false);
   typedef struct {
@@ -123,6 +195,7 @@ public:
     double * upperCoefficient;
     int unscaledChangesOffset; 
     bool firstIteration; // so can update rhs for accuracy
+    ClpParametricsPoints * points; // if not NULL breakpoints recorded here
   } parametricsData;
 
 private:
@@ -142,6 +215,8 @@ private:
                          ClpDataSave & data,bool canSkipFactorization=false);
      int parametricsObjLoop(parametricsData & paramData,
                          ClpDataSave & data,bool canSkipFactorization=false);
+     /// Reports breakpoint at theta and records it if paramData.points
+     void reportBreakpoint(parametricsData & paramData, double theta);
      /**  Refactorizes if necessary
           Checks if finished.  Updates status.
 
@@ -216,6 +291,10 @@ public:
                     int formatType = 0) const;
      /// Read a basis from the given filename
      int readBasis(const char *filename);
+     /// Write basis in compact binary form
+     int writeBinaryBasis(const char *filename) const;
+     /// Read a basis written by writeBinaryBasis
+     int readBinaryBasis(const char *filename);
      /** Creates dual of a problem if looks plausible
          (defaults will always create model)
          fractionRowRanges is fraction of rows allowed to have ranges
@@ -1600,6 +1600,8 @@ ClpSimplexPrimal::primalRow(CoinIndexedVector * rowArray,
                             CoinIndexedVector * spareArray,
                             int valuesPass)
 {
+     ClpProfileTimer timer(profile_, CLP_PROFILE_RATIO_TEST);
+     addWorkUnits(rowArray->getNumElements());
      double saveDj = dualIn_;
      if (valuesPass && objective_->type() < 2) {
           dualIn_ = cost_[sequenceIn_];
@@ -2085,6 +2087,8 @@ ClpSimplexPrimal::primalColumn(CoinIndexedVector * updates,
                                CoinIndexedVector * spareColumn1,
                                CoinIndexedVector * spareColumn2)
 {
+     ClpProfileTimer timer(profile_, CLP_PROFILE_PRICING);
+     addWorkUnits(numberRows_ + numberColumns_);
 
      ClpMatrixBase * saveMatrix = matrix_;
      double * saveRowScale = rowScale_;
@@ -338,17 +338,40 @@ solveWithVolume(ClpSimplex * model, int numberPasses, int doIdiot)
      return 0;
 }
 #endif
-static ClpInterior * currentModel2 = NULL;
 #endif
 //#############################################################################
 // Allow for interrupts
-// But is this threadsafe ? (so switched off by option)
+// Each interruptible solve takes a slot so that solves running concurrently
+// in different threads neither overwrite each other's models nor the saved
+// signal handler.  The handler is installed by the first solve to start and
+// restored by the last to finish; a signal stops every registered model.
 
 #include "CoinSignal.hpp"
-static ClpSimplex * currentModel = NULL;
+#if !defined(_MSC_VER) && !defined(CLP_NO_THREADS)
+#define CLP_SOLVE_THREADS
+#include <pthread.h>
+#define CLP_THREAD_LOCAL __thread
+static pthread_mutex_t interruptMutex = PTHREAD_MUTEX_INITIALIZER;
+#else
+#define CLP_THREAD_LOCAL
+#endif
+#define CLP_INTERRUPT_SLOTS 64
+typedef struct ClpInterruptSlot {
+     ClpSimplex * currentModel;
+#ifndef SLIM_CLP
+     ClpInterior * currentModel2;
+#endif
 #ifdef ABC_INHERIT
-static AbcSimplex * currentAbcModel = NULL;
+     AbcSimplex * currentAbcModel;
 #endif
+     ClpInterruptSlot * previous; // outer solve in same thread
+     bool inUse;
+} ClpInterruptSlot;
+static ClpInterruptSlot interruptSlots[CLP_INTERRUPT_SLOTS];
+static int numberInterruptSlots = 0;
+static CoinSighandler_t saveSignal = static_cast<CoinSighandler_t> (0);
+// slot of innermost interruptible solve in this thread
+static CLP_THREAD_LOCAL ClpInterruptSlot * currentInterrupt = NULL;
 
 extern "C" {
      static void
@@ -357,19 +380,77 @@ extern "C" {
 #endif // _MSC_VER
      signal_handler(int /*whichSignal*/)
      {
-          if (currentModel != NULL)
-               currentModel->setMaximumIterations(0); // stop at next iterations
+          for (int i = 0; i < CLP_INTERRUPT_SLOTS; i++) {
+               ClpInterruptSlot * slot = interruptSlots + i;
+               if (slot->currentModel != NULL)
+                    slot->currentModel->setMaximumIterations(0); // stop at next iterations
 #ifdef ABC_INHERIT
-          if (currentAbcModel != NULL)
-               currentAbcModel->setMaximumIterations(0); // stop at next iterations
+               if (slot->currentAbcModel != NULL)
+                    slot->currentAbcModel->setMaximumIterations(0); // stop at next iterations
 #endif
 #ifndef SLIM_CLP
-          if (currentModel2 != NULL)
-               currentModel2->setMaximumBarrierIterations(0); // stop at next iterations
+               if (slot->currentModel2 != NULL)
+                    slot->currentModel2->setMaximumBarrierIterations(0); // stop at next iterations
 #endif
+          }
           return;
      }
 }
+/* Takes a slot for an interruptible solve in this thread and registers
+   signal handler if first.  Returns false if all slots are in use in which
+   case solve goes ahead without interrupts. */
+static bool
+startInterrupt(ClpSimplex * model)
+{
+#ifdef CLP_SOLVE_THREADS
+     pthread_mutex_lock(&interruptMutex);
+#endif
+     ClpInterruptSlot * slot = NULL;
+     for (int i = 0; i < CLP_INTERRUPT_SLOTS; i++) {
+          if (!interruptSlots[i].inUse) {
+               slot = interruptSlots + i;
+               break;
+          }
+     }
+     if (slot) {
+          slot->inUse = true;
+          slot->previous = currentInterrupt;
+          currentInterrupt = slot;
+          slot->currentModel = model;
+          if (!numberInterruptSlots)
+               saveSignal = signal(SIGINT, signal_handler);
+          numberInterruptSlots++;
+     }
+#ifdef CLP_SOLVE_THREADS
+     pthread_mutex_unlock(&interruptMutex);
+#endif
+     return slot != NULL;
+}
+// Gives back slot taken by startInterrupt and restores handler if last
+static void
+endInterrupt()
+{
+#ifdef CLP_SOLVE_THREADS
+     pthread_mutex_lock(&interruptMutex);
+#endif
+     ClpInterruptSlot * slot = currentInterrupt;
+     currentInterrupt = slot->previous;
+     slot->currentModel = NULL;
+#ifndef SLIM_CLP
+     slot->currentModel2 = NULL;
+#endif
+#ifdef ABC_INHERIT
+     slot->currentAbcModel = NULL;
+#endif
+     slot->previous = NULL;
+     slot->inUse = false;
+     numberInterruptSlots--;
+     if (!numberInterruptSlots)
+          signal(SIGINT, saveSignal);
+#ifdef CLP_SOLVE_THREADS
+     pthread_mutex_unlock(&interruptMutex);
+#endif
+}
 #if ABC_INSTRUMENT>1
 int abcPricing[20];
 int abcPricingDense[20];
@@ -551,7 +632,7 @@ ClpSimplex::dealWithAbc(int solveType, int startUp,
   } else {
     AbcSimplex * abcModel2=new AbcSimplex(*this);
     if (interrupt)
-      currentAbcModel = abcModel2;
+      currentInterrupt->currentAbcModel = abcModel2;
     //if (abcSimplex_) {
     // move factorization stuff
     abcModel2->factorization()->synchronize(this->factorization(),abcModel2);
@@ -819,12 +900,9 @@ ClpSimplex::initialSolve(ClpSolve & options)
      }
      ClpSimplex * model2 = this;
      bool interrupt = (options.getSpecialOption(2) == 0);
-     CoinSighandler_t saveSignal = static_cast<CoinSighandler_t> (0);
-     if (interrupt) {
-          currentModel = model2;
-          // register signal handler
-          saveSignal = signal(SIGINT, signal_handler);
-     }
+     // register signal handler
+     if (interrupt)
+          interrupt = startInterrupt(model2);
      // If no status array - set up basis
      if (!status_)
           allSlackBasis();
@@ -906,6 +984,8 @@ ClpSimplex::initialSolve(ClpSolve & options)
                problemStatus_ = pinfo->presolveStatus(); 
                if (options.infeasibleReturn() || (moreSpecialOptions_ & 1) != 0) {
 		 delete pinfo;
+                    if (interrupt)
+                         endInterrupt();
                     return -1;
                }
                presolve = ClpSolve::presolveOff;
@@ -927,10 +1007,14 @@ ClpSimplex::initialSolve(ClpSolve & options)
 	      if (rcode==2) {
 		  delete model2;
 		 delete pinfo;
+		  if (interrupt)
+		    endInterrupt();
 		  return -2;
 	      } else if (rcode==3) {
 		  delete model2;
 		 delete pinfo;
+		  if (interrupt)
+		    endInterrupt();
 		  return -3;
 	      }
           }
@@ -949,7 +1033,7 @@ ClpSimplex::initialSolve(ClpSolve & options)
           }
      }
      if (interrupt)
-          currentModel = model2;
+          currentInterrupt->currentModel = model2;
      // For below >0 overrides
      // 0 means no, -1 means maybe
      int doIdiot = 0;
@@ -1827,7 +1911,7 @@ ClpSimplex::initialSolve(ClpSolve & options)
 #ifdef ABC_INHERIT
 		      AbcSimplex * abcModel2=new AbcSimplex(*model2);
 		      if (interrupt)
-			currentAbcModel = abcModel2;
+			currentInterrupt->currentAbcModel = abcModel2;
 		      if (abcSimplex_) {
 			// move factorization stuff
 			abcModel2->factorization()->synchronize(model2->factorization(),abcModel2);
@@ -2248,7 +2332,7 @@ ClpSimplex::initialSolve(ClpSolve & options)
                delete [] sumFixed;
                // Solve
                if (interrupt)
-                    currentModel = &small;
+                    currentInterrupt->currentModel = &small;
                small.defaultFactorizationFrequency();
                if (dynamic_cast< ClpPackedMatrix*>(matrix_)) {
                     // See if original wanted vector
@@ -2408,7 +2492,7 @@ ClpSimplex::initialSolve(ClpSolve & options)
                }
           }
           if (interrupt)
-               currentModel = model2;
+               currentInterrupt->currentModel = model2;
           for (i = 0; i < numberArtificials; i++)
                sort[i] = i + originalNumberColumns;
           model2->deleteColumns(numberArtificials, sort);
@@ -2467,7 +2551,7 @@ ClpSimplex::initialSolve(ClpSolve & options)
           ClpInterior barrier(*model2);
 #endif
           if (interrupt)
-               currentModel2 = &barrier;
+               currentInterrupt->currentModel2 = &barrier;
 	  if (barrier.numberRows()+barrier.numberColumns()>10000)
 	    barrier.setMaximumBarrierIterations(1000);
           int barrierOptions = options.getSpecialOption(4);
@@ -2505,6 +2589,11 @@ ClpSimplex::initialSolve(ClpSolve & options)
                barrierOptions &= ~8;
                scale = true;
           }
+          bool singlePrecision = false;
+          if (barrierOptions & 8192) {
+               barrierOptions &= ~8192;
+               singlePrecision = true;
+          }
           // If quadratic force KKT
           if (quadraticObj) {
                doKKT = true;
@@ -2513,7 +2602,11 @@ ClpSimplex::initialSolve(ClpSolve & options)
           case 0:
           default:
                if (!doKKT) {
-                    ClpCholeskyBase * cholesky = new ClpCholeskyBase(options.getExtraInfo(1));
+                    // -1 (not set) means find dense columns automatically
+                    int denseThreshold = options.getExtraInfo(1);
+                    if (denseThreshold == -1)
+                         denseThreshold = 0;
+                    ClpCholeskyBase * cholesky = new ClpCholeskyBase(denseThreshold);
                     cholesky->setIntegerParameter(0, speed);
                     barrier.setCholesky(cholesky);
                } else {
@@ -2525,6 +2618,7 @@ ClpSimplex::initialSolve(ClpSolve & options)
           case 1:
                if (!doKKT) {
                     ClpCholeskyDense * cholesky = new ClpCholeskyDense();
+                    cholesky->setSinglePrecision(singlePrecision);
                     barrier.setCholesky(cholesky);
                } else {
                     ClpCholeskyDense * cholesky = new ClpCholeskyDense();
@@ -3020,6 +3114,10 @@ ClpSimplex::initialSolve(ClpSolve & options)
 #endif
           if (extraPresolve) {
                pinfo2.postsolve(true);
+               if (saveModel2 && saveModel2->profile_ && model2->profile_)
+                    saveModel2->profile_->add(*model2->profile_);
+               if (saveModel2)
+                    saveModel2->workUnits_ = model2->workUnits_;
                delete model2;
                model2 = saveModel2;
           }
@@ -3083,6 +3181,10 @@ ClpSimplex::initialSolve(ClpSolve & options)
                     << CoinMessageEol;
           timeX = time2;
           if (!presolveToFile) {
+               // add in time in presolved model
+               if (profile_ && model2->profile_)
+                    profile_->add(*model2->profile_);
+               workUnits_ = model2->workUnits_;
 #if 1 //ndef ABC_INHERIT
                delete model2;
 #else
@@ -3093,7 +3195,7 @@ ClpSimplex::initialSolve(ClpSolve & options)
 #endif
 	  }
           if (interrupt)
-               currentModel = this;
+               currentInterrupt->currentModel = this;
           // checkSolution(); already done by postSolve
           setLogLevel(saveLevel);
 	  int oldStatus=problemStatus_;
@@ -3165,6 +3267,9 @@ ClpSimplex::initialSolve(ClpSolve & options)
           numberIterations_ = model2->numberIterations_;
           problemStatus_ = model2->problemStatus_;
           secondaryStatus_ = model2->secondaryStatus_;
+          workUnits_ = model2->workUnits_;
+          if (profile_ && model2->profile_)
+               profile_->add(*model2->profile_);
           delete model2;
      }
      if (method != ClpSolve::useBarrierNoCross &&
@@ -3183,7 +3288,7 @@ ClpSimplex::initialSolve(ClpSolve & options)
                << timeIdiot;
      handler_->message() << CoinMessageEol;
      if (interrupt)
-          signal(SIGINT, saveSignal);
+          endInterrupt();
      perturbation_ = savePerturbation;
      scalingFlag_ = saveScaling;
      // If faking objective - put back correct one
@@ -95,6 +95,7 @@ public:
        	   8 - bit set to do scaling
        	   16 - set to be aggressive with gamma/delta?
                       32 - Use KKT
+                      8192 - dense cholesky in single precision with refinement
          5 - for presolve
                       1 - switch off dual stuff
          6 - for detailed printout (initially just presolve)
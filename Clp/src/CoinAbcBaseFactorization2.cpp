@@ -1222,7 +1222,7 @@ CoinSimplexInt CoinAbcTypeFactorization::factorDense()
 #endif
 #else
     status=CoinAbcDgetrf(numberDense_,numberDense_,denseArea,numberDense_,densePermute
-#if ABC_PARALLEL==2
+#if ABC_PARALLEL
 			  ,parallelMode_
 #endif
 );
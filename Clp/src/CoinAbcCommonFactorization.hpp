@@ -75,13 +75,13 @@ typedef struct {
 } CoinAbcStack;
 void CoinAbcDgetrs(char trans,int m, double * a, double * work);
 int  CoinAbcDgetrf(int m, int n, double * a, int lda, int * ipiv
-#if ABC_PARALLEL==2
+#if ABC_PARALLEL
 			  ,int parallelMode
 #endif
 );
 void CoinAbcDgetrs(char trans,int m, long double * a, long double * work);
 int  CoinAbcDgetrf(int m, int n, long double * a, int lda, int * ipiv
-#if ABC_PARALLEL==2
+#if ABC_PARALLEL
 			  ,int parallelMode
 #endif
 );
@@ -49,7 +49,7 @@ void CoinAbcDenseFactorization::gutsOfDestructor()
   numberGoodU_ = 0;
   status_ = -1;
   maximumRows_=0;
-#if ABC_PARALLEL==2
+#if ABC_PARALLEL
   parallelMode_=0;
 #endif
   maximumSpace_=0;
@@ -71,7 +71,7 @@ void CoinAbcDenseFactorization::gutsOfInitialize()
   numberSlacks_ = 0;
   numberPivots_ = 0;
   maximumRows_=0;
-#if ABC_PARALLEL==2
+#if ABC_PARALLEL
   parallelMode_=0;
 #endif
   maximumSpace_=0;
@@ -106,7 +106,7 @@ void CoinAbcDenseFactorization::gutsOfCopy(const CoinAbcDenseFactorization &othe
   relaxCheck_ = other.relaxCheck_;
   numberRows_ = other.numberRows_;
   maximumRows_ = other.maximumRows_;
-#if ABC_PARALLEL==2
+#if ABC_PARALLEL
   parallelMode_=other.parallelMode_;
 #endif
   maximumSpace_ = other.maximumSpace_;
@@ -228,7 +228,7 @@ CoinAbcDenseFactorization::factor (AbcSimplex * /*model*/)
     // save last start
     CoinBigIndex lastStart=pivotRow_[numberRows_];
     status_=CoinAbcDgetrf(numberDense_,numberDense_,area,numberDense_,pivotRow_+numberDense_
-#if ABC_PARALLEL==2
+#if ABC_PARALLEL
 			  ,parallelMode_
 #endif
 			  );
@@ -54,7 +54,7 @@ public:
   inline int pivots (  ) const {
     return numberPivots_;
   }
-#if ABC_PARALLEL==2
+#if ABC_PARALLEL
   /// Says parallel
   inline void setParallelMode(int value)
   {parallelMode_=value;};
@@ -363,7 +363,7 @@ protected:
   int status_;
   /// Maximum rows ever (i.e. use to copy arrays etc)
   int maximumRows_;
-#if ABC_PARALLEL==2
+#if ABC_PARALLEL
   int parallelMode_;
 #endif
   /// Pivot row 
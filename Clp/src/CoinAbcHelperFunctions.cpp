@@ -1660,9 +1660,67 @@ scatterUpdate AbcScatterHighAdd[]={
 #define BLOCKING1 8 // factorization strip
 #define BLOCKING2 8 // dgemm recursive
 #define BLOCKING3 32 // dgemm parallel
+#if ABC_PARALLEL==1
+/* With pthreads each split of the Schur complement update hands one
+   half to a new thread.  Starting a thread costs more than a cilk spawn
+   so only split larger blocks.  parallelMode is number of extra threads
+   still allowed. */
+#include <pthread.h>
+#undef BLOCKING3
+#define BLOCKING3 128 // dgemm parallel
+void CoinAbcDgemm(int m, int n, int k, double * COIN_RESTRICT a,int lda,
+		  double * COIN_RESTRICT b,double * COIN_RESTRICT c,
+		  int parallelMode);
+typedef struct {
+  double * a;
+  double * b;
+  double * c;
+  int m;
+  int n;
+  int k;
+  int lda;
+  int parallelMode;
+} CoinAbcDgemmBlock;
+static inline void setDgemmBlock(CoinAbcDgemmBlock & block,int m, int n, int k,
+				 double * a,int lda,double * b,double * c)
+{
+  block.a=a;
+  block.b=b;
+  block.c=c;
+  block.m=m;
+  block.n=n;
+  block.k=k;
+  block.lda=lda;
+  block.parallelMode=0;
+}
+static void * doDgemmBlock(void * voidInfo)
+{
+  CoinAbcDgemmBlock * block = reinterpret_cast<CoinAbcDgemmBlock *>(voidInfo);
+  CoinAbcDgemm(block->m,block->n,block->k,block->a,block->lda,
+	       block->b,block->c,block->parallelMode);
+  return NULL;
+}
+// Does block[0] in new thread and block[1] in this one
+static void CoinAbcDgemmPair(CoinAbcDgemmBlock * block,int parallelMode)
+{
+  // share out remaining threads
+  int spare=parallelMode-1;
+  block[0].parallelMode=spare>>1;
+  block[1].parallelMode=spare-(spare>>1);
+  pthread_t thread;
+  if (pthread_create(&thread,NULL,doDgemmBlock,block)) {
+    // could not start thread - do in this one
+    doDgemmBlock(block);
+    doDgemmBlock(block+1);
+  } else {
+    doDgemmBlock(block+1);
+    pthread_join(thread,NULL);
+  }
+}
+#endif
 void CoinAbcDgemm(int m, int n, int k, double * COIN_RESTRICT a,int lda,
 			  double * COIN_RESTRICT b,double * COIN_RESTRICT c
-#if ABC_PARALLEL==2
+#if ABC_PARALLEL
 			  ,int parallelMode
 #endif
 )
@@ -1758,28 +1816,36 @@ void CoinAbcDgemm(int m, int n, int k, double * COIN_RESTRICT a,int lda,
     abort();
 #endif
     assert (mNew1>0&&m-mNew1>0);
-#if ABC_PARALLEL==2
+#if ABC_PARALLEL
     if (mNew1<=BLOCKING3||!parallelMode) {
 #endif
       //printf("splitMa mNew1 %d\n",mNew1);
       CoinAbcDgemm(mNew1,n,k,a,lda,b,c
-#if ABC_PARALLEL==2
+#if ABC_PARALLEL
 			  ,0
 #endif
 );
       //printf("splitMb mNew1 %d\n",mNew1);
       CoinAbcDgemm(m-mNew1,n,k,a+mNew1*BLOCKING8,lda,b,c+mNew1*BLOCKING8
-#if ABC_PARALLEL==2
+#if ABC_PARALLEL
 			  ,0
 #endif
 );
-#if ABC_PARALLEL==2
+#if ABC_PARALLEL
     } else {
+#if ABC_PARALLEL==2
       //printf("splitMa mNew1 %d\n",mNew1);
       cilk_spawn CoinAbcDgemm(mNew1,n,k,a,lda,b,c,ONWARD);
       //printf("splitMb mNew1 %d\n",mNew1);
       CoinAbcDgemm(m-mNew1,n,k,a+mNew1*BLOCKING8,lda,b,c+mNew1*BLOCKING8,ONWARD);
       cilk_sync;
+#else
+      // top rows in new thread, bottom rows in this one
+      CoinAbcDgemmBlock block[2];
+      setDgemmBlock(block[0],mNew1,n,k,a,lda,b,c);
+      setDgemmBlock(block[1],m-mNew1,n,k,a+mNew1*BLOCKING8,lda,b,c+mNew1*BLOCKING8);
+      CoinAbcDgemmPair(block,parallelMode);
+#endif
     }
 #endif
   } else {
@@ -1794,28 +1860,36 @@ void CoinAbcDgemm(int m, int n, int k, double * COIN_RESTRICT a,int lda,
     abort();
 #endif
     assert (nNew1>0&&n-nNew1>0);
-#if ABC_PARALLEL==2
+#if ABC_PARALLEL
     if (nNew1<=BLOCKING3||!parallelMode) {
 #endif
       //printf("splitNa nNew1 %d\n",nNew1);
       CoinAbcDgemm(m,nNew1,k,a,lda,b,c
-#if ABC_PARALLEL==2
+#if ABC_PARALLEL
 			  ,0
 #endif
 		    );
       //printf("splitNb nNew1 %d\n",nNew1);
       CoinAbcDgemm(m,n-nNew1,k,a,lda,b+lda*nNew1,c+lda*nNew1
-#if ABC_PARALLEL==2
+#if ABC_PARALLEL
 			  ,0
 #endif
 		    );
-#if ABC_PARALLEL==2
+#if ABC_PARALLEL
     } else {
+#if ABC_PARALLEL==2
       //printf("splitNa nNew1 %d\n",nNew1);
       cilk_spawn CoinAbcDgemm(m,nNew1,k,a,lda,b,c,ONWARD);
       //printf("splitNb nNew1 %d\n",nNew1);
       CoinAbcDgemm(m,n-nNew1,k,a,lda,b+lda*nNew1,c+lda*nNew1,ONWARD);
       cilk_sync;
+#else
+      // left columns in new thread, right columns in this one
+      CoinAbcDgemmBlock block[2];
+      setDgemmBlock(block[0],m,nNew1,k,a,lda,b,c);
+      setDgemmBlock(block[1],m,n-nNew1,k,a,lda,b+lda*nNew1,c+lda*nNew1);
+      CoinAbcDgemmPair(block,parallelMode);
+#endif
     }
 #endif
   }
@@ -1824,7 +1898,7 @@ void CoinAbcDgemm(int m, int n, int k, double * COIN_RESTRICT a,int lda,
 // Start long double version
 void CoinAbcDgemm(int m, int n, int k, long double * COIN_RESTRICT a,int lda,
 			  long double * COIN_RESTRICT b,long double * COIN_RESTRICT c
-#if ABC_PARALLEL==2
+#if ABC_PARALLEL
 			  ,int parallelMode
 #endif
 )
@@ -1920,22 +1994,22 @@ void CoinAbcDgemm(int m, int n, int k, long double * COIN_RESTRICT a,int lda,
     abort();
 #endif
     assert (mNew1>0&&m-mNew1>0);
-#if ABC_PARALLEL==2
+#if ABC_PARALLEL
     if (mNew1<=BLOCKING3||!parallelMode) {
 #endif
       //printf("splitMa mNew1 %d\n",mNew1);
       CoinAbcDgemm(mNew1,n,k,a,lda,b,c
-#if ABC_PARALLEL==2
+#if ABC_PARALLEL
 			  ,0
 #endif
 );
       //printf("splitMb mNew1 %d\n",mNew1);
       CoinAbcDgemm(m-mNew1,n,k,a+mNew1*BLOCKING8,lda,b,c+mNew1*BLOCKING8
-#if ABC_PARALLEL==2
+#if ABC_PARALLEL
 			  ,0
 #endif
 );
-#if ABC_PARALLEL==2
+#if ABC_PARALLEL
     } else {
       //printf("splitMa mNew1 %d\n",mNew1);
       cilk_spawn CoinAbcDgemm(mNew1,n,k,a,lda,b,c,ONWARD);
@@ -1956,22 +2030,22 @@ void CoinAbcDgemm(int m, int n, int k, long double * COIN_RESTRICT a,int lda,
     abort();
 #endif
     assert (nNew1>0&&n-nNew1>0);
-#if ABC_PARALLEL==2
+#if ABC_PARALLEL
     if (nNew1<=BLOCKING3||!parallelMode) {
 #endif
       //printf("splitNa nNew1 %d\n",nNew1);
       CoinAbcDgemm(m,nNew1,k,a,lda,b,c
-#if ABC_PARALLEL==2
+#if ABC_PARALLEL
 			  ,0
 #endif
 		    );
       //printf("splitNb nNew1 %d\n",nNew1);
       CoinAbcDgemm(m,n-nNew1,k,a,lda,b+lda*nNew1,c+lda*nNew1
-#if ABC_PARALLEL==2
+#if ABC_PARALLEL
 			  ,0
 #endif
 		    );
-#if ABC_PARALLEL==2
+#if ABC_PARALLEL
     } else {
       //printf("splitNa nNew1 %d\n",nNew1);
       cilk_spawn CoinAbcDgemm(m,nNew1,k,a,lda,b,c,ONWARD);
@@ -3561,13 +3561,17 @@ OsiClpSolverInterface::assignProblem(CoinPackedMatrix*& matrix,
 {
   modelPtr_->whatsChanged_ = 0;
   // Get rid of integer information (modelPtr will get rid of its copy)
-  loadProblem(*matrix, collb, colub, obj, rowlb, rowub);
-  delete matrix;   matrix = NULL;
-  delete[] collb;  collb = NULL;
-  delete[] colub;  colub = NULL;
-  delete[] obj;    obj = NULL;
-  delete[] rowlb;  rowlb = NULL;
-  delete[] rowub;  rowub = NULL;
+  delete [] integerInformation_;
+  integerInformation_=NULL;
+  // model takes over arrays (and sets them to NULL)
+  modelPtr_->assignProblem(matrix, collb, colub, obj, rowlb, rowub);
+  linearObjective_ = modelPtr_->objective();
+  freeCachedResults();
+  basis_=CoinWarmStartBasis();
+  if (ws_) {
+     delete ws_;
+     ws_ = 0;
+  }
 }
 
 //-----------------------------------------------------------------------------
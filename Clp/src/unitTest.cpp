@@ -14,8 +14,10 @@
 #include <cstdlib>
 #include <cmath>
 #include <cfloat>
+#include <cstring>
 #include <string>
 #include <iostream>
+#include <limits>
 
 #include "CoinMpsIO.hpp"
 #include "CoinPackedMatrix.hpp"
@@ -24,9 +26,11 @@
 #include "CoinHelperFunctions.hpp"
 #include "CoinTime.hpp"
 #include "CoinFloatEqual.hpp"
+#include "CoinBuild.hpp"
 
 #if CLP_HAS_ABC
 #include "CoinAbcCommon.hpp"
+#include "CoinAbcCommonFactorization.hpp"
 #endif
 #ifdef ABC_INHERIT
 #include "CoinAbcFactorization.hpp"
@@ -36,6 +40,8 @@
 #include "ClpSimplexOther.hpp"
 #include "ClpSimplexNonlinear.hpp"
 #include "ClpInterior.hpp"
+#include "ClpCholeskyBase.hpp"
+#include "ClpCholeskyDense.hpp"
 #include "ClpLinearObjective.hpp"
 #include "ClpDualRowSteepest.hpp"
 #include "ClpDualRowDantzig.hpp"
@@ -44,6 +50,7 @@
 #include "ClpParameters.hpp"
 #include "ClpNetworkMatrix.hpp"
 #include "ClpPlusMinusOneMatrix.hpp"
+#include "ClpDynamicMatrix.hpp"
 #include "MyMessageHandler.hpp"
 #include "MyEventHandler.hpp"
 
@@ -219,6 +226,94 @@ ClpSolve setupForSolve(int algorithm, std::string & nameAlgorithm,
      }
      return solveOptions;
 }
+// Keeps parametrics breakpoints - first entry is count
+static int saveBreakpoint(double theta, double objectiveValue, void * userData)
+{
+     double * points = reinterpret_cast<double *> (userData);
+     int n = static_cast<int> (points[0]);
+     if (2 * n + 2 >= 20)
+          return 1;
+     points[2*n+1] = theta;
+     points[2*n+2] = objectiveValue;
+     points[0] = n + 1;
+     return 0;
+}
+#if !defined(_MSC_VER) && !defined(CLP_NO_THREADS)
+#define CLP_TEST_THREADS
+#include <pthread.h>
+// One solve for concurrent solve test
+typedef struct {
+     const ClpSimplex * model;
+     double objectiveValue[2];
+     int numberIterations[2];
+} ClpConcurrentSolve;
+// Solves own copies of model with initialSolve and primal
+static void * solveConcurrent(void * info)
+{
+     ClpConcurrentSolve * solve = reinterpret_cast<ClpConcurrentSolve *> (info);
+     ClpSimplex model(*solve->model);
+     model.initialSolve();
+     solve->objectiveValue[0] = model.objectiveValue();
+     solve->numberIterations[0] = model.numberIterations();
+     ClpSimplex model2(*solve->model);
+     model2.primal();
+     solve->objectiveValue[1] = model2.objectiveValue();
+     solve->numberIterations[1] = model2.numberIterations();
+     return NULL;
+}
+#endif
+/* Column generation on a transportation problem - set i is supply of
+   source i and column (i,j) has a one in demand row j */
+class ClpTestGenerator : public ClpDynamicMatrix {
+public:
+     ClpTestGenerator(ClpSimplex * model, int numberSets, int numberDemands,
+                      const int * starts, const double * lower, const double * upper,
+                      const CoinBigIndex * startColumn, const int * row,
+                      const double * element, const double * cost,
+                      const double * fullCost)
+          : ClpDynamicMatrix(model, numberSets, starts[numberSets], starts, lower, upper,
+                             startColumn, row, element, cost),
+            numberDemands_(numberDemands),
+            fullCost_(fullCost) {}
+     virtual ClpMatrixBase * clone() const {
+          return new ClpTestGenerator(*this);
+     }
+     virtual int generateColumns(ClpSimplex * model) {
+          const double * duals = model->dualRowSolution();
+          int numberFull = numberSets_ * numberDemands_;
+          CoinBigIndex * starts = new CoinBigIndex [numberFull+1];
+          int * rows = new int [numberFull];
+          double * elements = new double [numberFull];
+          double * costs = new double [numberFull];
+          int * sets = new int [numberFull];
+          int n = 0;
+          starts[0] = 0;
+          for (int iSet = 0; iSet < numberSets_; iSet++) {
+               double djMod = gubDual(duals, iSet);
+               for (int j = 0; j < numberDemands_; j++) {
+                    double cost = fullCost_[iSet*numberDemands_+j];
+                    if (cost - djMod - duals[j] < -1.0e-7) {
+                         rows[n] = j;
+                         elements[n] = 1.0;
+                         costs[n] = cost;
+                         sets[n++] = iSet;
+                         starts[n] = n;
+                    }
+               }
+          }
+          int numberAdded = addColumns(n, starts, rows, elements, costs,
+                                       NULL, NULL, sets);
+          delete [] starts;
+          delete [] rows;
+          delete [] elements;
+          delete [] costs;
+          delete [] sets;
+          return numberAdded;
+     }
+private:
+     int numberDemands_;
+     const double * fullCost_;
+};
 static void printSol(ClpSimplex & model)
 {
      int numberRows = model.numberRows();
@@ -272,7 +367,219 @@ void usage(const std::string& key)
                << "    -dirNetlib: directory containing netlib files\"\n"
                << "        Default value V2=\"../../Data/Netlib\"\n"
                << "    -netlib\n"
-               << "        If specified, then netlib testset run as well as the nitTest.\n";
+               << "        If specified, then netlib testset run as well as the nitTest.\n"
+               << "    -benchmark=V3\n"
+               << "        If specified, then netlib testset timed and results written to V3\n"
+               << "        (as JSON if V3 ends in .json, otherwise as CSV)\n"
+               << "    -benchmarkRuns=V4\n"
+               << "        Number of runs of each model and variant.  Default value V4=3\n"
+               << "    -baseline=V5\n"
+               << "        CSV from an earlier benchmark to compare against\n"
+               << "  Status, objective and iterations are from the last run and\n"
+               << "  factorizations from an extra untimed run\n";
+}
+// One model and variant in benchmark
+typedef struct {
+     std::string name;
+     std::string variant;
+     int numberRows;
+     int numberColumns;
+     int status;
+     double objective;
+     int iterations;
+     // from untimed run with profiling, -1 if not known
+     int factorizations;
+     int runs;
+     double bestTime;
+     double averageTime;
+} benchmarkRecord;
+// Slower than baseline by more than this fraction (and minimum time) is a regression
+#define BENCHMARK_TOLERANCE 0.25
+#define BENCHMARK_MINIMUM_TIME 0.02
+/* Solves a model with dual, primal, barrier (and Abc if there) numberRuns
+   times each and adds a record for each variant.  Times are elapsed.
+   Factorizations are counted on an extra run so profiling is not timed. */
+static void benchmarkModel(const ClpSimplex & base, const std::string & name,
+                           const ClpSolve & solveOptionsIn, int numberRuns,
+                           std::vector<benchmarkRecord> & records)
+{
+#ifndef ABC_INHERIT
+     int numberVariants = 3;
+#else
+     int numberVariants = 4;
+#endif
+     const char * variantName[] = {"dual", "primal", "barrier", "abc"};
+     for (int iVariant = 0; iVariant < numberVariants; iVariant++) {
+          ClpSolve solveOptions = solveOptionsIn;
+          if (iVariant == 1) {
+               solveOptions.setSolveType(ClpSolve::usePrimal);
+          } else if (iVariant == 2) {
+               solveOptions.setSolveType(ClpSolve::useBarrier);
+               if (barrierAvailable == 1)
+                    solveOptions.setSpecialOption(4, 4);
+               else if (barrierAvailable == 2)
+                    solveOptions.setSpecialOption(4, 2);
+          } else {
+               solveOptions.setSolveType(ClpSolve::useDual);
+          }
+          benchmarkRecord record;
+          record.name = name;
+          record.variant = variantName[iVariant];
+          record.numberRows = base.numberRows();
+          record.numberColumns = base.numberColumns();
+          record.status = 0;
+          record.objective = 0.0;
+          record.iterations = 0;
+          record.factorizations = -1;
+          record.runs = numberRuns;
+          record.bestTime = COIN_DBL_MAX;
+          record.averageTime = 0.0;
+          if (iVariant < 3) {
+               // profile gives number of factorizations
+               ClpSimplex solution = base;
+               if (solution.maximumSeconds() < 0.0)
+                    solution.setMaximumSeconds(120.0);
+#ifdef ABC_INHERIT
+               solution.setAbcState(0);
+#endif
+               solution.setProfiling(true);
+               solution.initialSolve(solveOptions);
+               record.factorizations = solution.profile()->count[CLP_PROFILE_FACTORIZE];
+          }
+          for (int iRun = 0; iRun < numberRuns; iRun++) {
+               ClpSimplex solution = base;
+               if (solution.maximumSeconds() < 0.0)
+                    solution.setMaximumSeconds(120.0);
+#ifdef ABC_INHERIT
+               solution.setAbcState(iVariant == 3 ? 1 : 0);
+#endif
+               double time1 = CoinGetTimeOfDay();
+               solution.initialSolve(solveOptions);
+               double time2 = CoinGetTimeOfDay() - time1;
+               record.bestTime = CoinMin(record.bestTime, time2);
+               record.averageTime += time2;
+               // keep results of last run
+               record.status = solution.problemStatus();
+               record.objective = solution.objectiveValue();
+               record.iterations = solution.numberIterations();
+          }
+          record.averageTime /= numberRuns;
+          printf("Benchmark %s %s took %g seconds (best of %d) - %d iterations, status %d\n",
+                 name.c_str(), record.variant.c_str(), record.bestTime, numberRuns,
+                 record.iterations, record.status);
+          records.push_back(record);
+     }
+}
+// Returns string with " and \ escaped for JSON
+static std::string jsonString(const std::string & value)
+{
+     std::string escaped;
+     for (size_t i = 0; i < value.length(); i++) {
+          if (value[i] == '"' || value[i] == '\\')
+               escaped += '\\';
+          escaped += value[i];
+     }
+     return escaped;
+}
+// Writes benchmark records as CSV or (if name ends in .json) JSON
+static void writeBenchmark(const std::string & fileName,
+                           const std::vector<benchmarkRecord> & records)
+{
+     FILE * fp = fopen(fileName.c_str(), "w");
+     if (!fp) {
+          std::cerr << "Unable to open benchmark file " << fileName << std::endl;
+          return;
+     }
+     size_t length = fileName.length();
+     bool json = length > 5 && fileName.substr(length - 5) == ".json";
+     if (json)
+          fprintf(fp, "[\n");
+     else
+          fprintf(fp, "model,variant,rows,columns,status,objective,iterations,"
+                  "factorizations,runs,best_seconds,mean_seconds\n");
+     for (size_t i = 0; i < records.size(); i++) {
+          const benchmarkRecord & record = records[i];
+          if (json)
+               fprintf(fp, "  {\"model\": \"%s\", \"variant\": \"%s\", \"rows\": %d, "
+                       "\"columns\": %d, \"status\": %d, \"objective\": %.12g, "
+                       "\"iterations\": %d, \"factorizations\": %d, \"runs\": %d, "
+                       "\"best_seconds\": %.6f, \"mean_seconds\": %.6f}%s\n",
+                       jsonString(record.name).c_str(), jsonString(record.variant).c_str(),
+                       record.numberRows, record.numberColumns, record.status,
+                       record.objective, record.iterations, record.factorizations,
+                       record.runs, record.bestTime, record.averageTime,
+                       i + 1 < records.size() ? "," : "");
+          else
+               fprintf(fp, "%s,%s,%d,%d,%d,%.12g,%d,%d,%d,%.6f,%.6f\n",
+                       record.name.c_str(), record.variant.c_str(), record.numberRows,
+                       record.numberColumns, record.status, record.objective,
+                       record.iterations, record.factorizations, record.runs,
+                       record.bestTime, record.averageTime);
+     }
+     if (json)
+          fprintf(fp, "]\n");
+     fclose(fp);
+     printf("Benchmark results for %d model/variant pairs written to %s\n",
+            static_cast<int>(records.size()), fileName.c_str());
+}
+/* Compares best times and status against CSV from an earlier benchmark.
+   Returns number of regressions */
+static int compareBenchmark(const std::string & fileName,
+                            const std::vector<benchmarkRecord> & records)
+{
+     FILE * fp = fopen(fileName.c_str(), "r");
+     if (!fp) {
+          std::cerr << "Unable to open benchmark baseline " << fileName << std::endl;
+          return 1;
+     }
+     int numberRegressions = 0;
+     int numberFaster = 0;
+     int numberCompared = 0;
+     char line[1000];
+     while (fgets(line, sizeof(line), fp)) {
+          // split into fields
+          std::vector<std::string> field;
+          char * next = line;
+          while (true) {
+               char * comma = strchr(next, ',');
+               if (comma)
+                    *comma = '\0';
+               field.push_back(next);
+               if (!comma)
+                    break;
+               next = comma + 1;
+          }
+          if (field.size() < 11 || field[0] == "model")
+               continue;
+          int status = atoi(field[4].c_str());
+          int iterations = atoi(field[6].c_str());
+          double bestTime = atof(field[9].c_str());
+          for (size_t i = 0; i < records.size(); i++) {
+               const benchmarkRecord & record = records[i];
+               if (record.name != field[0] || record.variant != field[1])
+                    continue;
+               numberCompared++;
+               if (record.status && !status) {
+                    printf("Regression on %s %s - status %d against %d in baseline\n",
+                           field[0].c_str(), field[1].c_str(), record.status, status);
+                    numberRegressions++;
+               } else if (record.bestTime > bestTime * (1.0 + BENCHMARK_TOLERANCE) &&
+                          record.bestTime > bestTime + BENCHMARK_MINIMUM_TIME) {
+                    printf("Regression on %s %s - %g seconds against %g in baseline (%d iterations against %d)\n",
+                           field[0].c_str(), field[1].c_str(), record.bestTime, bestTime,
+                           record.iterations, iterations);
+                    numberRegressions++;
+               } else if (bestTime > record.bestTime * (1.0 + BENCHMARK_TOLERANCE) &&
+                          bestTime > record.bestTime + BENCHMARK_MINIMUM_TIME) {
+                    numberFaster++;
+               }
+               break;
+          }
+     }
+     fclose(fp);
+     printf("Compared %d against baseline %s - %d regressions, %d faster\n",
+            numberCompared, fileName.c_str(), numberRegressions, numberFaster);
+     return numberRegressions;
 }
 #if FACTORIZATION_STATISTICS
 int loSizeX=-1;
@@ -309,6 +616,9 @@ int mainTest (int argc, const char *argv[], int algorithm,
      definedKeyWords.insert("-dirSample");
      definedKeyWords.insert("-dirNetlib");
      definedKeyWords.insert("-netlib");
+     definedKeyWords.insert("-benchmark");
+     definedKeyWords.insert("-benchmarkRuns");
+     definedKeyWords.insert("-baseline");
 
      // Create a map of parameter keys and associated data
      std::map<std::string, std::string> parms;
@@ -350,13 +660,22 @@ int mainTest (int argc, const char *argv[], int algorithm,
           dirNetlib = parms["-dirNetlib"];
      else
           dirNetlib = dirsep == '/' ? "../../Data/Netlib/" : "..\\..\\Data\\Netlib\\";
+     // Benchmark rather than test
+     std::string benchmarkFile;
+     if (parms.find("-benchmark") != parms.end())
+          benchmarkFile = parms["-benchmark"];
+     bool benchmark = benchmarkFile != "";
+     int benchmarkRuns = 3;
+     if (parms.find("-benchmarkRuns") != parms.end())
+          benchmarkRuns = CoinMax(1, atoi(parms["-benchmarkRuns"].c_str()));
+     std::vector<benchmarkRecord> benchmarkRecords;
 #if 0 //FACTORIZATION_STATISTICS==0
      if (!empty.numberRows()) {
           testingMessage( "Testing ClpSimplex\n" );
           ClpSimplexUnitTest(dirSample);
      }
 #endif
-     if (parms.find("-netlib") != parms.end() || empty.numberRows()) {
+     if (parms.find("-netlib") != parms.end() || empty.numberRows() || benchmark) {
           unsigned int m;
 	  std::string sizeLoHi;
 #if FACTORIZATION_STATISTICS
@@ -401,7 +720,7 @@ int mainTest (int argc, const char *argv[], int algorithm,
           std::vector<double> objValueTol;
           // 100 added means no presolve
           std::vector<int> bestStrategy;
-          if(empty.numberRows()) {
+          if(empty.numberRows() && !benchmark) {
                std::string alg;
                for (int iTest = 0; iTest < NUMBER_ALGORITHMS; iTest++) {
                     ClpSolve solveOptions = setupForSolve(iTest, alg, 0);
@@ -1065,7 +1384,7 @@ int mainTest (int argc, const char *argv[], int algorithm,
                bestStrategy.push_back(0);
                int iTest;
                std::string alg;
-               for (iTest = 0; iTest < NUMBER_ALGORITHMS; iTest++) {
+               for (iTest = 0; iTest < NUMBER_ALGORITHMS && !benchmark; iTest++) {
                     ClpSolve solveOptions = setupForSolve(iTest, alg, 0);
                     printf("%d %s ", iTest, alg.c_str());
                     if (switchOff[iTest])
@@ -1110,6 +1429,11 @@ int mainTest (int argc, const char *argv[], int algorithm,
 
                     solutionBase.setDblParam(ClpObjOffset, mps.objectiveOffset());
                }
+               if (benchmark) {
+                    benchmarkModel(solutionBase, mpsName[m], solveOptionsIn,
+                                   benchmarkRuns, benchmarkRecords);
+                    continue;
+               }
 
                // Runs through strategies
                if (algorithm == 6 || algorithm == 7) {
@@ -1357,7 +1681,13 @@ int mainTest (int argc, const char *argv[], int algorithm,
 		    }
                }
           }
-          printf("Total time %g seconds\n", timeTaken);
+          if (benchmark) {
+               writeBenchmark(benchmarkFile, benchmarkRecords);
+               if (parms.find("-baseline") != parms.end())
+                    numberFailures += compareBenchmark(parms["-baseline"], benchmarkRecords);
+          } else {
+               printf("Total time %g seconds\n", timeTaken);
+          }
 #if FACTORIZATION_STATISTICS
 	  double bestTime=1.0e100;
 	  int iBestTime=-1;
@@ -1715,6 +2045,903 @@ ClpSimplexUnitTest(const std::string & dirSample)
                               NULL, NULL, rhs, rhs, NULL);
 #endif
      }
+     // Test ranging of whole model in threads matches ranging by list
+     {
+          CoinMpsIO m;
+          std::string fn = dirSample + "e226";
+          if (m.readMps(fn.c_str(), "mps") == 0) {
+               ClpSimplex model;
+               model.loadProblem(*m.getMatrixByCol(), m.getColLower(), m.getColUpper(),
+                                 m.getObjCoefficients(),
+                                 m.getRowLower(), m.getRowUpper());
+               model.setLogLevel(0);
+               model.dual();
+               int numberTotal = model.numberRows() + model.numberColumns();
+               int * which = new int [numberTotal];
+               double * values = new double [8*numberTotal];
+               int * sequences = new int [8*numberTotal];
+               int i;
+               for (i = 0; i < numberTotal; i++)
+                    which[i] = i;
+               model.dualRanging(numberTotal, which, values, sequences,
+                                 values + numberTotal, sequences + numberTotal);
+               model.primalRanging(numberTotal, which, values + 2 * numberTotal,
+                                   sequences + 2 * numberTotal,
+                                   values + 3 * numberTotal, sequences + 3 * numberTotal);
+               double * values2 = values + 4 * numberTotal;
+               int * sequences2 = sequences + 4 * numberTotal;
+               int returnCode = model.fullRanging(4, values2, sequences2,
+                                                  values2 + numberTotal, sequences2 + numberTotal,
+                                                  values2 + 2 * numberTotal, sequences2 + 2 * numberTotal,
+                                                  values2 + 3 * numberTotal, sequences2 + 3 * numberTotal);
+               assert (!returnCode);
+               for (i = 0; i < 4 * numberTotal; i++) {
+                    assert (sequences[i] == sequences2[i]);
+                    assert (fabs(values[i] - values2[i]) <= 1.0e-9 * (1.0 + fabs(values[i])));
+               }
+               // just value ranging
+               returnCode = model.fullRanging(4, NULL, NULL, NULL, NULL,
+                                              values2, sequences2,
+                                              values2 + numberTotal, sequences2 + numberTotal);
+               assert (!returnCode);
+               for (i = 0; i < 2 * numberTotal; i++) {
+                    assert (sequences[i+2*numberTotal] == sequences2[i]);
+                    assert (fabs(values[i+2*numberTotal] - values2[i]) <=
+                            1.0e-9 * (1.0 + fabs(values[i+2*numberTotal])));
+               }
+               // part of a set missing is an error
+               returnCode = model.fullRanging(4, values2, NULL,
+                                              values2 + numberTotal, sequences2 + numberTotal,
+                                              NULL, NULL, NULL, NULL);
+               assert (returnCode == -1);
+               delete [] which;
+               delete [] values;
+               delete [] sequences;
+          } else {
+               std::cerr << "Error reading e226 from sample data. Skipping test." << std::endl;
+          }
+     }
+     // Test parametrics in segments
+     {
+          /*
+             min -x1 - 2x2
+             x1 + x2 <= 4 + theta
+                  x2 <= 3 - 0.25 theta
+             x1      <= 2 + 0.5 theta
+             basis changes at theta 4/3
+          */
+          int rowIndices[4] =  {0, 2, 0, 1};
+          int colIndices[4] =  {0, 0, 1, 1};
+          double elements[4] = {1.0, 1.0, 1.0, 1.0};
+          CoinPackedMatrix matrix(true, rowIndices, colIndices, elements, 4);
+          double columnLower[2] = {0.0, 0.0};
+          double columnUpper[2] = {COIN_DBL_MAX, COIN_DBL_MAX};
+          double objective[2] = { -1.0, -2.0};
+          double rowLower[3] = { -COIN_DBL_MAX, -COIN_DBL_MAX, -COIN_DBL_MAX};
+          double rowUpper[3] = {4.0, 3.0, 2.0};
+          double change[3] = {1.0, -0.25, 0.5};
+          ClpSimplex model;
+          model.loadProblem(matrix, columnLower, columnUpper, objective,
+                            rowLower, rowUpper);
+          model.setLogLevel(0);
+          model.scaling(0);
+          model.dual();
+          for (int numberSegments = 1; numberSegments <= 4; numberSegments *= 2) {
+               double points[20];
+               points[0] = 0.0;
+               int returnCode = static_cast<ClpSimplexOther *> (&model)->
+                                parametricsParallel(0.0, 10.0, numberSegments, numberSegments,
+                                                    NULL, NULL, change, change,
+                                                    saveBreakpoint, points);
+               assert (!returnCode);
+               // segment ends are not breakpoints so same answer each time
+               assert (points[0] == 3.0);
+               assert (fabs(points[1] - 0.0) < 1.0e-8 && fabs(points[2] + 7.0) < 1.0e-8);
+               assert (fabs(points[3] - 4.0 / 3.0) < 1.0e-8 && fabs(points[4] + 8.0) < 1.0e-8);
+               assert (fabs(points[5] - 10.0) < 1.0e-8 && fabs(points[6] + 8.0) < 1.0e-8);
+          }
+          // original model is unchanged
+          assert (model.rowUpper()[0] == 4.0);
+          // breakpoints are recorded directly whatever the log level
+          ClpSimplex model3(model);
+          model3.setLogLevel(0);
+          ClpParametricsPoints points = {NULL, NULL, 0, 0};
+          double endingTheta = 10.0;
+          int returnCode = static_cast<ClpSimplexOther *> (&model3)->
+                           parametrics(0.0, endingTheta, NULL, NULL, change, change, &points);
+          assert (!returnCode && points.numberPoints == 3);
+          assert (fabs(points.theta[0]) < 1.0e-8 && fabs(points.objective[0] + 7.0) < 1.0e-8);
+          assert (fabs(points.theta[1] - 4.0 / 3.0) < 1.0e-8 && fabs(points.objective[1] + 8.0) < 1.0e-8);
+          assert (fabs(points.theta[2] - 10.0) < 1.0e-8 && fabs(points.objective[2] + 8.0) < 1.0e-8);
+          delete [] points.theta;
+          delete [] points.objective;
+     }
+     // Test dense factorization gives same answer
+     {
+          ClpSimplex model;
+          std::string fn = dirSample + "e226.mps";
+          model.setLogLevel(0);
+          if (model.readMps(fn.c_str(), true) == 0) {
+               ClpSimplex model2(model);
+               model.dual();
+               model2.factorization()->forceOtherFactorization(1);
+               model2.dual();
+               assert (!model2.problemStatus());
+               assert (fabs(model.objectiveValue() - model2.objectiveValue()) <=
+                       1.0e-8 * (1.0 + fabs(model.objectiveValue())));
+               // and optimal basis checks out
+               model2.primal();
+               assert (!model2.numberIterations());
+          } else {
+               std::cerr << "Error reading e226 from sample data. Skipping test." << std::endl;
+          }
+     }
+#if CLP_HAS_ABC && ABC_PARALLEL
+     // Test Abc dense LU with extra threads matches serial LU
+     {
+          const int n = 512;
+          double * a = new double [n*n];
+          double * a2 = new double [n*n];
+          int * ipiv = new int [n];
+          int * ipiv2 = new int [n];
+          CoinSeedRandom(1234567);
+          for (int i = 0; i < n * n; i++)
+               a[i] = CoinDrand48() - 0.5;
+          CoinMemcpyN(a, n * n, a2);
+          int returnCode = CoinAbcDgetrf(n, n, a, n, ipiv, 0);
+          int returnCode2 = CoinAbcDgetrf(n, n, a2, n, ipiv2, 3);
+          assert (!returnCode && !returnCode2);
+          // threads only split the update so answer is identical
+          assert (!memcmp(ipiv, ipiv2, n * sizeof(int)));
+          assert (!memcmp(a, a2, n * n * sizeof(double)));
+          delete [] a;
+          delete [] a2;
+          delete [] ipiv;
+          delete [] ipiv2;
+     }
+#endif
+     // Test refactorizing on measured cost gives same answer
+     {
+          ClpSimplex model;
+          std::string fn = dirSample + "e226.mps";
+          model.setLogLevel(0);
+          if (model.readMps(fn.c_str(), true) == 0) {
+               ClpSimplex model2(model);
+               model.dual();
+               ClpFactorization * factorization = model2.factorization();
+               factorization->setAdaptiveRefactorization(1);
+               // any measured pivot cost asks for refactorization
+               factorization->setCostRatio(0.0);
+               model2.setFactorizationFrequency(500);
+               model2.setProfiling(true);
+               model2.dual();
+               assert (!model2.problemStatus());
+               assert (fabs(model.objectiveValue() - model2.objectiveValue()) <=
+                       1.0e-8 * (1.0 + fabs(model.objectiveValue())));
+               assert (factorization->factorizationTime() > 0.0);
+               assert (factorization->solveTime() > 0.0);
+               int numberCost = factorization->numberCostRefactorizations();
+               assert (numberCost > 0);
+               assert (numberCost < model2.profile()->count[CLP_PROFILE_FACTORIZE]);
+               double average = factorization->averageCostPivots();
+               assert (average >= 10.0 && average <= 500.0);
+               assert (average * numberCost <= model2.numberIterations());
+          } else {
+               std::cerr << "Error reading e226 from sample data. Skipping test." << std::endl;
+          }
+     }
+     // Test triangular and bump sizes of factorization
+     {
+          // slacks basic on rows 0 and 1, columns 0 and 1 are then
+          // triangular on rows 2 and 3 and columns 2 and 3 form a
+          // full block on rows 4 and 5
+          ClpSimplex model;
+          CoinBigIndex start[5] = {0, 2, 5, 8, 11};
+          int row[11] = {0, 2,
+                         1, 2, 3,
+                         3, 4, 5,
+                         2, 4, 5
+                        };
+          double element[11] = {1.0, 1.0,
+                                1.0, 2.0, 1.0,
+                                1.0, 1.0, 3.0,
+                                1.0, 2.0, 1.0
+                               };
+          double objective[4] = {1.0, 1.0, 1.0, 1.0};
+          double columnLower[4] = {0.0, 0.0, 0.0, 0.0};
+          double columnUpper[4] = {10.0, 10.0, 10.0, 10.0};
+          double rowLower[6] = {0.0, 0.0, 0.0, 0.0, 0.0, 0.0};
+          double rowUpper[6] = {100.0, 100.0, 100.0, 100.0, 100.0, 100.0};
+          model.loadProblem(4, 6, start, row, element, columnLower, columnUpper,
+                            objective, rowLower, rowUpper);
+          model.setLogLevel(0);
+          model.createStatus();
+          for (int iRow = 2; iRow < 6; iRow++)
+               model.setRowStatus(iRow, ClpSimplex::atLowerBound);
+          for (int iColumn = 0; iColumn < 4; iColumn++)
+               model.setColumnStatus(iColumn, ClpSimplex::basic);
+          int returnCode = model.factorize();
+          assert (!returnCode);
+          ClpFactorization * factorization = model.factorization();
+          assert (factorization->numberTriangular() == 2);
+          assert (factorization->bumpSize() == 2);
+          // slack on row 4 instead of column 3 - column 2 is then
+          // a singleton on row 5 and there is no bump
+          model.setRowStatus(4, ClpSimplex::basic);
+          model.setColumnStatus(3, ClpSimplex::atLowerBound);
+          returnCode = model.factorize();
+          assert (!returnCode);
+          assert (factorization->numberTriangular() == 3);
+          assert (factorization->bumpSize() == 0);
+     }
+     // Test profile of phases of iterations
+     {
+          ClpSimplex model;
+          std::string fn = dirSample + "e226.mps";
+          model.setLogLevel(0);
+          if (model.readMps(fn.c_str(), true) == 0) {
+               model.setProfiling(true);
+               ClpSimplex model2(model);
+               model.dual();
+               assert (!model.problemStatus());
+               const ClpSimplexProfile * profile = model.profile();
+               assert (profile);
+               assert (profile->count[CLP_PROFILE_FACTORIZE] > 0);
+               assert (profile->count[CLP_PROFILE_FTRAN] > 0);
+               assert (profile->count[CLP_PROFILE_BTRAN] > 0);
+               assert (profile->count[CLP_PROFILE_PRICING] > 0);
+               for (int i = 0; i < CLP_PROFILE_NUMBER; i++)
+                    assert (profile->time[i] >= 0.0);
+               // copy has its own profile
+               assert (model2.profile() && model2.profile() != profile);
+               assert (!model2.profile()->count[CLP_PROFILE_FACTORIZE]);
+               model.clearProfile();
+               assert (!profile->count[CLP_PROFILE_FTRAN]);
+               model.setProfiling(false);
+               assert (!model.profile());
+          } else {
+               std::cerr << "Error reading e226 from sample data. Skipping test." << std::endl;
+          }
+     }
+     // Test work units are repeatable and can be used as a limit
+     {
+          ClpSimplex model;
+          std::string fn = dirSample + "e226.mps";
+          model.setLogLevel(0);
+          if (model.readMps(fn.c_str(), true) == 0) {
+               ClpSimplex model2(model);
+               ClpSimplex model3(model);
+               model.dual();
+               assert (!model.problemStatus());
+               double work = model.workUnits();
+               assert (work > 0.0);
+               model2.dual();
+               assert (model2.workUnits() == work);
+               model3.setMaximumWorkUnits(0.5 * work);
+               model3.dual();
+               assert (model3.problemStatus() == 3);
+               assert (model3.secondaryStatus() == 11);
+               assert (model3.workUnits() >= 0.5 * work);
+          } else {
+               std::cerr << "Error reading e226 from sample data. Skipping test." << std::endl;
+          }
+     }
+     // Test binary basis files
+     {
+          ClpSimplex model;
+          std::string fn = dirSample + "e226.mps";
+          model.setLogLevel(0);
+          if (model.readMps(fn.c_str(), true) == 0) {
+               ClpSimplex model2(model);
+               model.dual();
+               assert (!model.problemStatus());
+               assert (!model.writeBinaryBasis("e226.bin"));
+               // readBasis recognizes binary file
+               assert (!model2.readBasis("e226.bin"));
+               int numberTotal = model.numberRows() + model.numberColumns();
+               for (int i = 0; i < numberTotal; i++)
+                    assert ((model.statusArray()[i] & 7) == (model2.statusArray()[i] & 7) ||
+                            (model.statusArray()[i] & 7) == ClpSimplex::isFixed);
+               model2.dual();
+               assert (!model2.problemStatus());
+               assert (model2.numberIterations() <= 1);
+               // MPS basis is not binary
+               assert (!model.writeBasis("e226.bas"));
+               assert (model2.readBinaryBasis("e226.bas") == -2);
+               // Wrong size
+               ClpSimplex model3;
+               fn = dirSample + "afiro.mps";
+               if (model3.readMps(fn.c_str(), true) == 0)
+                    assert (model3.readBinaryBasis("e226.bin") == -3);
+               // Corrupt
+               FILE * fp = fopen("e226.bin", "r+b");
+               fseek(fp, 30, SEEK_SET);
+               int byte = fgetc(fp);
+               fseek(fp, 30, SEEK_SET);
+               fputc(byte ^ 1, fp);
+               fclose(fp);
+               assert (model2.readBinaryBasis("e226.bin") == -3);
+               // Number of structurals far more than file holds
+               assert (!model.writeBinaryBasis("e226.bin"));
+               fp = fopen("e226.bin", "r+b");
+               fseek(fp, 8, SEEK_SET);
+               unsigned char largest[4] = {0xff, 0xff, 0xff, 0x7f};
+               fwrite(largest, 1, 4, fp);
+               fclose(fp);
+               assert (model2.readBinaryBasis("e226.bin") == -3);
+               // Truncated
+               assert (!model.writeBinaryBasis("e226.bin"));
+               fp = fopen("e226.bin", "rb");
+               unsigned char start[30];
+               assert (fread(start, 1, 30, fp) == 30);
+               fclose(fp);
+               fp = fopen("e226.bin", "wb");
+               fwrite(start, 1, 30, fp);
+               fclose(fp);
+               assert (model2.readBinaryBasis("e226.bin") == -3);
+               remove("e226.bin");
+               remove("e226.bas");
+          } else {
+               std::cerr << "Error reading e226 from sample data. Skipping test." << std::endl;
+          }
+     }
+     // Test assignProblem takes over arrays
+     {
+          ClpSimplex model;
+          std::string fn = dirSample + "e226.mps";
+          model.setLogLevel(0);
+          if (model.readMps(fn.c_str(), true) == 0) {
+               int numberRows = model.numberRows();
+               int numberColumns = model.numberColumns();
+               CoinPackedMatrix * matrix = new CoinPackedMatrix();
+               // row ordered to check reordering
+               matrix->reverseOrderedCopyOf(*model.matrix());
+               double * columnLower = CoinCopyOfArray(model.columnLower(), numberColumns);
+               double * columnUpper = CoinCopyOfArray(model.columnUpper(), numberColumns);
+               double * objective = CoinCopyOfArray(model.objective(), numberColumns);
+               double * rowLower = CoinCopyOfArray(model.rowLower(), numberRows);
+               double * rowUpper = NULL;
+               const double * saveLower = columnLower;
+               ClpSimplex model2;
+               model2.setLogLevel(0);
+               model2.assignProblem(matrix, columnLower, columnUpper, objective,
+                                    rowLower, rowUpper);
+               assert (!matrix && !columnLower && !columnUpper && !objective && !rowLower);
+               assert (model2.columnLower() == saveLower);
+               assert (model2.matrix()->isEquivalent(*model.matrix()));
+               // row upper bounds were defaulted
+               model2.setObjectiveOffset(model.objectiveOffset());
+               model2.chgRowUpper(model.rowUpper());
+               model.dual();
+               model2.dual();
+               assert (!model2.problemStatus());
+               assert (fabs(model2.objectiveValue() - model.objectiveValue()) < 1.0e-7);
+          } else {
+               std::cerr << "Error reading e226 from sample data. Skipping test." << std::endl;
+          }
+     }
+     // Test deleting rows and columns keeps scale factors of survivors
+     {
+          ClpSimplex model;
+          std::string fn = dirSample + "e226.mps";
+          model.setLogLevel(0);
+          if (model.readMps(fn.c_str(), true) == 0) {
+               ClpSimplex fresh(model);
+               model.dual();
+               assert (model.rowScale() && model.columnScale());
+               int numberRows = model.numberRows();
+               int numberColumns = model.numberColumns();
+               double * rowScale = CoinCopyOfArray(model.rowScale(), 2 * numberRows);
+               double * columnScale = CoinCopyOfArray(model.columnScale(), 2 * numberColumns);
+               int * which = new int [numberColumns];
+               int numberDelete = 0;
+               for (int i = 0; i < numberRows; i += 10)
+                    which[numberDelete++] = i;
+               model.deleteRows(numberDelete, which);
+               fresh.deleteRows(numberDelete, which);
+               assert (model.rowScale() && model.columnScale());
+               int n = 0;
+               for (int i = 0; i < numberRows; i++) {
+                    if (i % 10) {
+                         assert (model.rowScale()[n] == rowScale[i]);
+                         assert (model.inverseRowScale()[n] == rowScale[i+numberRows]);
+                         n++;
+                    }
+               }
+               numberRows = n;
+               for (int i = 0; i < numberColumns; i++)
+                    assert (model.columnScale()[i] == columnScale[i]);
+               double * rowScale2 = CoinCopyOfArray(model.rowScale(), 2 * numberRows);
+               numberDelete = 0;
+               for (int i = 3; i < numberColumns; i += 17)
+                    which[numberDelete++] = i;
+               model.deleteColumns(numberDelete, which);
+               fresh.deleteColumns(numberDelete, which);
+               assert (model.columnScale());
+               n = 0;
+               for (int i = 0; i < numberColumns; i++) {
+                    if ((i % 17) != 3) {
+                         assert (model.columnScale()[n] == columnScale[i]);
+                         assert (model.inverseColumnScale()[n] == columnScale[i+numberColumns]);
+                         n++;
+                    }
+               }
+               assert (n == model.numberColumns());
+               for (int i = 0; i < 2 * numberRows; i++)
+                    assert (model.rowScale()[i] == rowScale2[i]);
+               delete [] rowScale2;
+               model.allSlackBasis();
+               model.dual();
+               fresh.dual();
+               assert (model.problemStatus() == fresh.problemStatus());
+               if (!model.problemStatus())
+                    assert (fabs(model.objectiveValue() - fresh.objectiveValue()) <
+                            1.0e-7 * (1.0 + fabs(fresh.objectiveValue())));
+               // deleting every row drops all scale factors
+               numberRows = model.numberRows();
+               for (int i = 0; i < numberRows; i++)
+                    which[i] = i;
+               model.deleteRows(numberRows, which);
+               assert (!model.numberRows());
+               assert (!model.rowScale() && !model.columnScale());
+               delete [] which;
+               delete [] rowScale;
+               delete [] columnScale;
+          } else {
+               std::cerr << "Error reading e226 from sample data. Skipping test." << std::endl;
+          }
+     }
+     // Test added columns are scaled against existing row scales
+     {
+          ClpSimplex model;
+          std::string fn = dirSample + "e226.mps";
+          model.setLogLevel(0);
+          if (model.readMps(fn.c_str(), true) == 0) {
+               ClpSimplex fresh(model);
+               int numberRows = model.numberRows();
+               int numberColumns = model.numberColumns();
+               int numberKeep = (9 * numberColumns) / 10;
+               int numberDelete = numberColumns - numberKeep;
+               int * which = new int [numberDelete];
+               for (int i = 0; i < numberDelete; i++)
+                    which[i] = numberKeep + i;
+               model.deleteColumns(numberDelete, which);
+               delete [] which;
+               model.dual();
+               assert (model.rowScale() && model.columnScale());
+               double * rowScale = CoinCopyOfArray(model.rowScale(), 2 * numberRows);
+               double * columnScale = CoinCopyOfArray(model.columnScale(), 2 * numberKeep);
+               const CoinPackedMatrix * matrix = fresh.matrix();
+               const CoinBigIndex * columnStart = matrix->getVectorStarts();
+               const int * columnLength = matrix->getVectorLengths();
+               CoinBigIndex * starts = new CoinBigIndex [numberDelete+1];
+               starts[0] = 0;
+               for (int i = 0; i < numberDelete; i++)
+                    starts[i+1] = starts[i] + columnLength[numberKeep+i];
+               CoinBigIndex start = columnStart[numberKeep];
+               assert (starts[numberDelete] + start == matrix->getNumElements());
+               model.addColumns(numberDelete, fresh.columnLower() + numberKeep,
+                                fresh.columnUpper() + numberKeep,
+                                fresh.objective() + numberKeep, starts,
+                                matrix->getIndices() + start,
+                                matrix->getElements() + start);
+               delete [] starts;
+               // scales kept and new ones sensible
+               assert (model.rowScale() && model.columnScale());
+               for (int i = 0; i < 2 * numberRows; i++)
+                    assert (model.rowScale()[i] == rowScale[i]);
+               for (int i = 0; i < numberKeep; i++) {
+                    assert (model.columnScale()[i] == columnScale[i]);
+                    assert (model.inverseColumnScale()[i] == columnScale[i+numberKeep]);
+               }
+               for (int i = numberKeep; i < numberColumns; i++) {
+                    double value = model.columnScale()[i];
+                    assert (value > 0.0 && fabs(value * model.inverseColumnScale()[i] - 1.0) < 1.0e-12);
+               }
+               model.dual();
+               fresh.dual();
+               assert (!model.problemStatus());
+               assert (fabs(model.objectiveValue() - fresh.objectiveValue()) <
+                       1.0e-7 * (1.0 + fabs(fresh.objectiveValue())));
+               // column with a much worse spread asks for full rescale
+               int rows[2] = {0, 1};
+               double elements[2] = {1.0e-6, 1.0e6};
+               model.addColumn(2, rows, elements, 0.0, 1.0, 0.0);
+               assert (!model.rowScale() && !model.columnScale());
+               model.dual();
+               assert (!model.problemStatus());
+               // small batches keep scales until too many added since full scale
+               int numberBatch = numberColumns / 20;
+               starts = new CoinBigIndex [numberBatch+1];
+               starts[0] = 0;
+               for (int i = 0; i < numberBatch; i++)
+                    starts[i+1] = starts[i] + columnLength[i];
+               int numberBatches = 0;
+               while (model.rowScale()) {
+                    model.addColumns(numberBatch, fresh.columnLower(),
+                                     fresh.columnUpper(), fresh.objective(), starts,
+                                     matrix->getIndices(), matrix->getElements());
+                    numberBatches++;
+                    assert (numberBatches * numberBatch <= model.numberColumns() / 2);
+               }
+               assert (numberBatches > 1);
+               // full scale on solve starts count again
+               model.dual();
+               assert (!model.problemStatus());
+               assert (model.rowScale());
+               model.addColumns(numberBatch, fresh.columnLower(),
+                                fresh.columnUpper(), fresh.objective(), starts,
+                                matrix->getIndices(), matrix->getElements());
+               assert (model.rowScale() && model.columnScale());
+               delete [] starts;
+               delete [] rowScale;
+               delete [] columnScale;
+          } else {
+               std::cerr << "Error reading e226 from sample data. Skipping test." << std::endl;
+          }
+     }
+     // Test column generation on dynamic matrix
+     {
+          int numberSets = 20;
+          int numberDemands = 30;
+          int numberFull = numberSets * numberDemands;
+          double * fullCost = new double [numberFull];
+          double * supply = new double [numberSets];
+          double * demand = new double [numberDemands];
+          for (int i = 0; i < numberSets; i++) {
+               supply[i] = 10.0 + (i * 7) % 11;
+               for (int j = 0; j < numberDemands; j++)
+                    fullCost[i*numberDemands+j] = 1.0 + (i * 13 + j * 7) % 17;
+          }
+          for (int j = 0; j < numberDemands; j++)
+               demand[j] = 3.0 + (j * 5) % 7;
+          double penalty = 1000.0;
+          // full problem - demand rows then supply rows then penalties
+          ClpSimplex full;
+          full.setLogLevel(0);
+          full.addRows(numberDemands, demand, NULL, NULL, NULL, NULL);
+          full.addRows(numberSets, NULL, supply, NULL, NULL, NULL);
+          for (int i = 0; i < numberSets; i++) {
+               for (int j = 0; j < numberDemands; j++) {
+                    int rows[2] = {j, numberDemands + i};
+                    double elements[2] = {1.0, 1.0};
+                    full.addColumn(2, rows, elements, 0.0, COIN_DBL_MAX,
+                                   fullCost[i*numberDemands+j]);
+               }
+          }
+          for (int j = 0; j < numberDemands; j++) {
+               double one = 1.0;
+               full.addColumn(1, &j, &one, 0.0, COIN_DBL_MAX, penalty);
+          }
+          full.primal();
+          assert (!full.problemStatus());
+          for (int numberThreads = 1; numberThreads <= 2; numberThreads++) {
+               // only demand rows and penalties in static part
+               ClpSimplex model;
+               model.setLogLevel(0);
+               model.addRows(numberDemands, demand, NULL, NULL, NULL, NULL);
+               for (int j = 0; j < numberDemands; j++) {
+                    double one = 1.0;
+                    model.addColumn(1, &j, &one, 0.0, COIN_DBL_MAX, penalty);
+               }
+               model.createStatus();
+               // one column in each set to start
+               int * starts = new int [numberSets+1];
+               double * lower = new double [numberSets];
+               CoinBigIndex * startColumn = new CoinBigIndex [numberSets+1];
+               int * row = new int [numberSets];
+               double * element = new double [numberSets];
+               double * cost = new double [numberSets];
+               startColumn[0] = 0;
+               for (int i = 0; i < numberSets; i++) {
+                    starts[i] = i;
+                    lower[i] = 0.0;
+                    row[i] = i % numberDemands;
+                    element[i] = 1.0;
+                    cost[i] = fullCost[i*numberDemands+row[i]];
+                    startColumn[i+1] = i + 1;
+               }
+               starts[numberSets] = numberSets;
+               ClpTestGenerator * matrix =
+                    new ClpTestGenerator(&model, numberSets, numberDemands, starts,
+                                         lower, supply, startColumn, row, element,
+                                         cost, fullCost);
+               model.replaceMatrix(matrix, true);
+               model.setSpecialOptions(4);
+               model.scaling(0);
+               ClpPrimalColumnSteepest steepest(5);
+               model.setPrimalColumnPivotAlgorithm(steepest);
+               int status = matrix->columnGeneration(&model, 100, 5.0, numberThreads);
+               assert (!status);
+               assert (fabs(model.objectiveValue() - full.objectiveValue()) < 1.0e-6);
+               // nothing left to price in pool and far from all columns stored
+               double * reducedCost = new double [matrix->numberGubColumns()];
+               assert (!matrix->priceColumns(&model, reducedCost, numberThreads));
+               assert (matrix->numberGubColumns() < numberFull);
+               // adding a stored column again does nothing - try one in small problem
+               int iStored;
+               for (iStored = 0; iStored < matrix->numberGubColumns(); iStored++) {
+                    if (matrix->getDynamicStatus(iStored) != ClpDynamicMatrix::atLowerBound)
+                         break;
+               }
+               assert (iStored < matrix->numberGubColumns());
+               ClpDynamicMatrix::DynamicStatus oldStatus = matrix->getDynamicStatus(iStored);
+               int set;
+               for (set = 0; set < numberSets; set++) {
+                    int j = matrix->startSets()[set];
+                    while (j >= 0 && j != iStored)
+                         j = matrix->next()[j];
+                    if (j == iStored)
+                         break;
+               }
+               assert (set < numberSets);
+               CoinBigIndex start2[2] = {0, 0};
+               start2[1] = matrix->startColumn()[iStored+1] - matrix->startColumn()[iStored];
+               // copy as pool may be moved
+               int * row2 = CoinCopyOfArray(matrix->row() + matrix->startColumn()[iStored],
+                                            start2[1]);
+               double * element2 = CoinCopyOfArray(matrix->element() +
+                                                   matrix->startColumn()[iStored], start2[1]);
+               double cost2 = matrix->cost()[iStored];
+               double objValue = model.objectiveValue();
+               assert (!matrix->addColumns(1, start2, row2, element2, &cost2, NULL, NULL, &set));
+               delete [] row2;
+               delete [] element2;
+               assert (matrix->getDynamicStatus(iStored) == oldStatus);
+               model.primal(1);
+               assert (!model.problemStatus());
+               assert (fabs(model.objectiveValue() - objValue) < 1.0e-6);
+               delete [] reducedCost;
+               delete [] starts;
+               delete [] lower;
+               delete [] startColumn;
+               delete [] row;
+               delete [] element;
+               delete [] cost;
+          }
+          delete [] fullCost;
+          delete [] supply;
+          delete [] demand;
+     }
+     // Test loading from several build objects (as if one per thread)
+     {
+          ClpSimplex model;
+          std::string fn = dirSample + "e226.mps";
+          model.setLogLevel(0);
+          if (model.readMps(fn.c_str(), true) == 0) {
+               int numberRows = model.numberRows();
+               int numberColumns = model.numberColumns();
+               const CoinPackedMatrix * columnCopy = model.matrix();
+               CoinPackedMatrix rowCopy;
+               rowCopy.reverseOrderedCopyOf(*columnCopy);
+               CoinBuild rowBuild[3];
+               CoinBuild columnBuild[3];
+               for (int iRow = 0; iRow < numberRows; iRow++) {
+                    CoinShallowPackedVector row = rowCopy.getVector(iRow);
+                    rowBuild[(3*iRow)/numberRows].addRow(row.getNumElements(),
+                                                        row.getIndices(), row.getElements(),
+                                                        model.rowLower()[iRow], model.rowUpper()[iRow]);
+               }
+               for (int iColumn = 0; iColumn < numberColumns; iColumn++) {
+                    CoinShallowPackedVector column = columnCopy->getVector(iColumn);
+                    columnBuild[(3*iColumn)/numberColumns].addColumn(column.getNumElements(),
+                                                                     column.getIndices(), column.getElements(),
+                                                                     model.columnLower()[iColumn],
+                                                                     model.columnUpper()[iColumn],
+                                                                     model.objective()[iColumn]);
+               }
+               const CoinBuild * builds[3];
+               ClpSimplex model2;
+               model2.setLogLevel(0);
+               model2.addColumns(numberColumns, model.columnLower(), model.columnUpper(),
+                                 model.objective(), NULL, NULL, NULL);
+               for (int i = 0; i < 3; i++)
+                    builds[i] = rowBuild + i;
+               assert (!model2.addRows(3, builds));
+               ClpSimplex model3;
+               model3.setLogLevel(0);
+               model3.addRows(numberRows, model.rowLower(), model.rowUpper(), NULL, NULL, NULL);
+               for (int i = 0; i < 3; i++)
+                    builds[i] = columnBuild + i;
+               assert (!model3.addColumns(3, builds));
+               assert (model2.matrix()->isEquivalent(*columnCopy));
+               assert (model3.matrix()->isEquivalent(*columnCopy));
+               // e226 has a constant in objective
+               model2.setObjectiveOffset(model.objectiveOffset());
+               model3.setObjectiveOffset(model.objectiveOffset());
+               model.dual();
+               model2.dual();
+               model3.dual();
+               assert (!model2.problemStatus() && !model3.problemStatus());
+               assert (fabs(model2.objectiveValue() - model.objectiveValue()) < 1.0e-7);
+               assert (fabs(model3.objectiveValue() - model.objectiveValue()) < 1.0e-7);
+               // duplicate is reported
+               CoinBuild bad;
+               int columns[2] = {0, 0};
+               double elements[2] = {1.0, 1.0};
+               bad.addRow(2, columns, elements);
+               ClpSimplex model4;
+               model4.addColumns(numberColumns, NULL, NULL, NULL, NULL, NULL, NULL);
+               builds[0] = &bad;
+               assert (model4.addRows(1, builds) == 1);
+          } else {
+               std::cerr << "Error reading e226 from sample data. Skipping test." << std::endl;
+          }
+     }
+     // Test hashed name lookup kept up to date as model changes
+     {
+          ClpSimplex model;
+          std::string fn = dirSample + "afiro.mps";
+          model.setLogLevel(0);
+          if (model.readMps(fn.c_str(), true) == 0) {
+               model.setNameHashing(true);
+               int numberRows = model.numberRows();
+               int numberColumns = model.numberColumns();
+               for (int i = 0; i < numberRows; i++)
+                    assert (model.rowIndex(model.rowName(i)) == i);
+               for (int i = 0; i < numberColumns; i++)
+                    assert (model.columnIndex(model.columnName(i)) == i);
+               assert (model.rowIndex("no_such_row") < 0);
+               std::string oldName = model.rowName(3);
+               std::string newName = "renamed";
+               model.setRowName(3, newName);
+               assert (model.rowIndex(oldName) < 0);
+               assert (model.rowIndex(newName) == 3);
+               std::string name5 = model.columnName(5);
+               std::string name6 = model.columnName(6);
+               int which[2] = {1, 5};
+               model.deleteColumns(2, which);
+               assert (model.columnIndex(name5) < 0);
+               assert (model.columnIndex(name6) == 4);
+               int start[2] = {0, 0};
+               model.addRows(1, NULL, NULL, start, NULL, NULL);
+               assert (model.rowIndex(model.rowName(numberRows)) == numberRows);
+               // same answers without hashing
+               ClpSimplex model2(model);
+               model2.setNameHashing(false);
+               for (int i = 0; i < model.numberRows(); i++)
+                    assert (model2.rowIndex(model.rowName(i)) == model.rowIndex(model.rowName(i)));
+               for (int i = 0; i < model.numberColumns(); i++)
+                    assert (model2.columnIndex(model.columnName(i)) == i);
+               // readBasis finds renamed row through hash
+               model.dual();
+               assert (!model.problemStatus());
+               assert (!model.writeBasis("afiro.bas"));
+               // same as reading with names hashed by CoinMpsIO
+               ClpSimplex model4(model);
+               model4.allSlackBasis();
+               double * solution = new double [model.numberColumns()];
+               CoinMpsIO m;
+               m.messageHandler()->setLogLevel(0);
+               assert (!m.readBasis("afiro.bas", "", solution,
+                                    model4.statusArray() + model.numberColumns(),
+                                    model4.statusArray(),
+                                    *model4.columnNames(), model.numberColumns(),
+                                    *model4.rowNames(), model.numberRows()));
+               delete [] solution;
+               assert (model4.getRowStatus(3) != ClpSimplex::basic);
+               for (int iPass = 0; iPass < 2; iPass++) {
+                    ClpSimplex model3(iPass ? model2 : model);
+                    assert (model3.nameHashing() == !iPass);
+                    model3.allSlackBasis();
+                    assert (!model3.readBasis("afiro.bas"));
+                    // hashing left as it was
+                    assert (model3.nameHashing() == !iPass);
+                    int numberTotal = model.numberRows() + model.numberColumns();
+                    for (int i = 0; i < numberTotal; i++)
+                         assert (model3.statusArray()[i] == model4.statusArray()[i]);
+                    model3.dual();
+                    assert (!model3.problemStatus());
+               }
+               remove("afiro.bas");
+          } else {
+               std::cerr << "Error reading afiro from sample data. Skipping test." << std::endl;
+          }
+     }
+     // Test solving variants of a model matches solving each from scratch
+     {
+          ClpSimplex model;
+          std::string fn = dirSample + "afiro.mps";
+          model.setLogLevel(0);
+          if (model.readMps(fn.c_str(), true) == 0) {
+               model.dual();
+               int numberColumns = model.numberColumns();
+               int numberRows = model.numberRows();
+#define NUMBER_VARIANTS 7
+               double * objectives = new double [NUMBER_VARIANTS*numberColumns];
+               double * upper = new double [NUMBER_VARIANTS*numberRows];
+               double * solutions = new double [NUMBER_VARIANTS*numberColumns];
+               const double * objective[NUMBER_VARIANTS];
+               const double * rowUpper[NUMBER_VARIANTS];
+               double * columnSolution[NUMBER_VARIANTS];
+               for (int i = 0; i < NUMBER_VARIANTS; i++) {
+                    objective[i] = objectives + i * numberColumns;
+                    // every third variant keeps row upper bounds of model
+                    rowUpper[i] = (i % 3) ? upper + i * numberRows : NULL;
+                    columnSolution[i] = solutions + i * numberColumns;
+                    for (int j = 0; j < numberColumns; j++)
+                         objectives[i*numberColumns+j] = model.objective()[j] *
+                                                          (1.0 + 0.1 * ((i * 7 + j) % 5 - 2));
+                    for (int j = 0; j < numberRows; j++)
+                         upper[i*numberRows+j] = model.rowUpper()[j] < 1.0e30 ?
+                                                  model.rowUpper()[j] * (1.0 + 0.05 * ((i + j) % 3)) :
+                                                  model.rowUpper()[j];
+               }
+               for (int numberThreads = 1; numberThreads <= 3; numberThreads += 2) {
+                    double objectiveValue[NUMBER_VARIANTS];
+                    int status[NUMBER_VARIANTS];
+                    int numberBad = static_cast<ClpSimplexOther *> (&model)->
+                                    solveVariants(NUMBER_VARIANTS, numberThreads,
+                                                  NULL, NULL, objective, NULL, rowUpper,
+                                                  columnSolution, objectiveValue, status);
+                    assert (!numberBad);
+                    for (int i = 0; i < NUMBER_VARIANTS; i++) {
+                         ClpSimplex variant(model);
+                         variant.chgObjCoefficients(objective[i]);
+                         if (rowUpper[i])
+                              variant.chgRowUpper(rowUpper[i]);
+                         variant.allSlackBasis();
+                         variant.dual();
+                         assert (!status[i]);
+                         assert (fabs(objectiveValue[i] - variant.objectiveValue()) <=
+                                 1.0e-7 * (1.0 + fabs(variant.objectiveValue())));
+                         double value = 0.0;
+                         for (int j = 0; j < numberColumns; j++)
+                              value += columnSolution[i][j] * objective[i][j];
+                         assert (fabs(value - objectiveValue[i]) <=
+                                 1.0e-7 * (1.0 + fabs(value)));
+                    }
+               }
+               // model itself is not changed
+               assert (!model.problemStatus());
+               delete [] objectives;
+               delete [] upper;
+               delete [] solutions;
+#undef NUMBER_VARIANTS
+          } else {
+               std::cerr << "Error reading afiro from sample data. Skipping test." << std::endl;
+          }
+     }
+#ifdef CLP_TEST_THREADS
+     // Test independent models solved concurrently match serial solves
+     {
+          const char * names[] = {"afiro", "brandy", "e226", "finnis"};
+#define NUMBER_CONCURRENT 4
+          ClpSimplex models[NUMBER_CONCURRENT];
+          ClpConcurrentSolve serial[NUMBER_CONCURRENT];
+          ClpConcurrentSolve concurrent[2*NUMBER_CONCURRENT];
+          pthread_t threads[2*NUMBER_CONCURRENT];
+          int numberModels = 0;
+          for (int i = 0; i < NUMBER_CONCURRENT; i++) {
+               std::string fn = dirSample + names[i] + ".mps";
+               models[numberModels].setLogLevel(0);
+               if (models[numberModels].readMps(fn.c_str(), true) == 0)
+                    numberModels++;
+               else
+                    std::cerr << "Error reading " << names[i]
+                              << " from sample data. Skipping it." << std::endl;
+          }
+          for (int i = 0; i < numberModels; i++) {
+               serial[i].model = models + i;
+               solveConcurrent(serial + i);
+          }
+          // two threads per model so copies of same model run together
+          for (int i = 0; i < 2 * numberModels; i++) {
+               concurrent[i].model = models + (i % numberModels);
+               pthread_create(threads + i, NULL, solveConcurrent, concurrent + i);
+          }
+          for (int i = 0; i < 2 * numberModels; i++)
+               pthread_join(threads[i], NULL);
+          for (int i = 0; i < 2 * numberModels; i++) {
+               const ClpConcurrentSolve & one = serial[i % numberModels];
+               for (int j = 0; j < 2; j++) {
+                    assert (concurrent[i].objectiveValue[j] == one.objectiveValue[j]);
+                    assert (concurrent[i].numberIterations[j] == one.numberIterations[j]);
+               }
+          }
+#undef NUMBER_CONCURRENT
+     }
+#endif
      // Test binv etc
      {
           /*
@@ -2351,6 +3578,160 @@ ClpSimplexUnitTest(const std::string & dirSample)
                std::cerr << "Error reading exmip1 from sample data. Skipping test." << std::endl;
           }
      }
+     // Test barrier with a dense linking column
+     {
+          int numberRows = 300;
+          int numberColumns = numberRows + 1;
+          CoinBigIndex * starts = new CoinBigIndex[numberColumns+1];
+          int * rows = new int[3*numberRows];
+          double * elements = new double[3*numberRows];
+          double * objective = new double[numberColumns];
+          double * columnLower = new double[numberColumns];
+          double * columnUpper = new double[numberColumns];
+          double * rowLower = new double[numberRows];
+          double * rowUpper = new double[numberRows];
+          CoinBigIndex n = 0;
+          int i;
+          for (i = 0; i < numberRows; i++) {
+               starts[i] = n;
+               rows[n] = i;
+               elements[n++] = 1.0;
+               if (i + 1 < numberRows) {
+                    rows[n] = i + 1;
+                    elements[n++] = 1.0;
+               }
+               objective[i] = 1.0 + (i % 3);
+               columnLower[i] = 0.0;
+               columnUpper[i] = 10.0;
+               rowLower[i] = 1.0 + 0.5 * (i % 5);
+               rowUpper[i] = COIN_DBL_MAX;
+          }
+          // linking column in every row
+          starts[numberRows] = n;
+          for (i = 0; i < numberRows; i++) {
+               rows[n] = i;
+               elements[n++] = 1.0;
+          }
+          starts[numberColumns] = n;
+          objective[numberRows] = 150.0;
+          columnLower[numberRows] = 0.0;
+          columnUpper[numberRows] = 5.0;
+          ClpSimplex simplex;
+          simplex.loadProblem(numberColumns, numberRows, starts, rows, elements,
+                              columnLower, columnUpper, objective,
+                              rowLower, rowUpper);
+          ClpInterior barrier;
+          barrier.loadProblem(numberColumns, numberRows, starts, rows, elements,
+                              columnLower, columnUpper, objective,
+                              rowLower, rowUpper);
+          simplex.setLogLevel(0);
+          simplex.dual();
+          ClpCholeskyBase * cholesky = new ClpCholeskyBase(0);
+          barrier.setCholesky(cholesky);
+          barrier.setLogLevel(0);
+          barrier.primalDual();
+          assert (cholesky->numberDenseColumns() == 1);
+          double objValue = simplex.objectiveValue();
+          assert (fabs(barrier.objectiveValue() - objValue) < 1.0e-5 * (1.0 + fabs(objValue)));
+          delete [] starts;
+          delete [] rows;
+          delete [] elements;
+          delete [] objective;
+          delete [] columnLower;
+          delete [] columnUpper;
+          delete [] rowLower;
+          delete [] rowUpper;
+     }
+     // Test single precision dense Cholesky
+     {
+          CoinMpsIO m;
+          std::string fn = dirSample + "afiro";
+          if (m.readMps(fn.c_str(), "mps") == 0) {
+               ClpInterior barrier;
+               barrier.loadProblem(*m.getMatrixByCol(), m.getColLower(), m.getColUpper(),
+                                   m.getObjCoefficients(),
+                                   m.getRowLower(), m.getRowUpper());
+               barrier.setLogLevel(0);
+               ClpCholeskyDense * cholesky = new ClpCholeskyDense();
+               cholesky->setSinglePrecision(true);
+               barrier.setCholesky(cholesky);
+               // stop early so last factorization is still in float
+               barrier.setMaximumBarrierIterations(3);
+               barrier.primalDual();
+               assert (cholesky->singlePrecision());
+               int numberRows = cholesky->numberRows();
+               int numberDropped = cholesky->numberRowsDropped();
+               CoinWorkDouble * region = new CoinWorkDouble [3*numberRows];
+               CoinWorkDouble * region2 = region + numberRows;
+               CoinWorkDouble * region3 = region2 + numberRows;
+               int i;
+               for (i = 0; i < numberRows; i++)
+                    region[i] = 1.0 + (i % 7);
+               CoinMemcpyN(region, numberRows, region2);
+               // refinement converges
+               cholesky->solve(region);
+               assert (cholesky->singlePrecision());
+               // refinement can not converge - goes to double
+               for (i = 0; i < numberRows; i++)
+                    region3[i] = 1.0;
+               region3[0] = std::numeric_limits<double>::quiet_NaN();
+               cholesky->solve(region3);
+               assert (!cholesky->singlePrecision());
+               assert (cholesky->numberRowsDropped() == numberDropped);
+               // double factor agrees with refined float one
+               cholesky->solve(region2);
+               for (i = 0; i < numberRows; i++)
+                    assert (fabs(region[i] - region2[i]) < 1.0e-7 * (1.0 + fabs(region2[i])));
+               delete [] region;
+          } else {
+               std::cerr << "Error reading afiro from sample data. Skipping test." << std::endl;
+          }
+     }
+     // Test vector dense Cholesky gives same factor as scalar code
+     {
+          int sizes[] = {37, 48, 70, 101, 130};
+          for (int iSize = 0; iSize < 5; iSize++) {
+               int numberRows = sizes[iSize];
+               ClpCholeskyDense * cholesky[3];
+               int level[3];
+               for (int iLevel = 0; iLevel < 3; iLevel++) {
+                    level[iLevel] = ClpCholeskySetSimdLevel(iLevel);
+                    ClpCholeskyDense * dense = new ClpCholeskyDense();
+                    cholesky[iLevel] = dense;
+                    dense->reserveSpace(NULL, numberRows);
+                    // positive definite - strictly lower triangle by columns
+                    longDouble * a = dense->aMatrix();
+                    CoinZeroN(a, dense->size());
+                    longDouble * diagonal = dense->diagonal();
+                    for (int i = 0; i < numberRows; i++) {
+                         diagonal[i] = numberRows;
+                         for (int j = i + 1; j < numberRows; j++)
+                              *a++ = ((i * 7 + j * 13) % 17) / 17.0 - 0.5;
+                    }
+                    int * dropped = new int [numberRows];
+                    CoinZeroN(dropped, numberRows);
+                    dense->factorizePart2(dropped);
+                    for (int i = 0; i < numberRows; i++)
+                         assert (!dropped[i]);
+                    delete [] dropped;
+               }
+               ClpCholeskySetSimdLevel(2);
+               for (int iLevel = 1; iLevel < 3; iLevel++) {
+                    if (level[iLevel] != iLevel)
+                         continue;
+                    const longDouble * a0 = cholesky[0]->aMatrix();
+                    const longDouble * a1 = cholesky[iLevel]->aMatrix();
+                    for (CoinBigIndex i = 0; i < cholesky[0]->size(); i++)
+                         assert (fabs(a0[i] - a1[i]) < 1.0e-12 * (1.0 + fabs(a0[i])));
+                    const longDouble * d0 = cholesky[0]->diagonal();
+                    const longDouble * d1 = cholesky[iLevel]->diagonal();
+                    for (int i = 0; i < numberRows; i++)
+                         assert (fabs(d0[i] - d1[i]) < 1.0e-12 * (1.0 + fabs(d0[i])));
+               }
+               for (int iLevel = 0; iLevel < 3; iLevel++)
+                    delete cholesky[iLevel];
+          }
+     }
 #endif
      // test network
 #define QUADRATIC
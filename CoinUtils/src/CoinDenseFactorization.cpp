@@ -32,6 +32,93 @@ extern "C"
 			       int trans_len);
 }
 #endif
+#if COIN_BIG_DOUBLE!=1 && defined(__GNUC__) && !defined(__INTEL_COMPILER) && defined(__x86_64__) && !defined(COIN_NO_DENSE_SIMD) && (__GNUC__ >= 5 || defined(__clang__))
+/* AVX2 kernels chosen at run time so the library still runs on any x86_64.
+   Define COIN_NO_DENSE_SIMD to always use the plain loops */
+#define COIN_DENSE_SIMD
+typedef double CoinDenseVector __attribute__((vector_size(32), may_alias, aligned(8)));
+// y -= a * x
+__attribute__((target("avx2,fma"))) static void
+CoinDenseAxpyAvx2(int n, double a, const double * COIN_RESTRICT x,
+		  double * COIN_RESTRICT y)
+{
+  CoinDenseVector va = {a, a, a, a};
+  int j = 0;
+  for (; j + 8 <= n; j += 8) {
+    CoinDenseVector y0 = *reinterpret_cast<CoinDenseVector *>(y + j);
+    CoinDenseVector y1 = *reinterpret_cast<CoinDenseVector *>(y + j + 4);
+    y0 -= va * *reinterpret_cast<const CoinDenseVector *>(x + j);
+    y1 -= va * *reinterpret_cast<const CoinDenseVector *>(x + j + 4);
+    *reinterpret_cast<CoinDenseVector *>(y + j) = y0;
+    *reinterpret_cast<CoinDenseVector *>(y + j + 4) = y1;
+  }
+  for (; j < n; j++)
+    y[j] -= a * x[j];
+}
+// returns x.y
+__attribute__((target("avx2,fma"))) static double
+CoinDenseDotAvx2(int n, const double * COIN_RESTRICT x,
+		 const double * COIN_RESTRICT y)
+{
+  CoinDenseVector t0 = {0.0, 0.0, 0.0, 0.0};
+  CoinDenseVector t1 = t0;
+  int j = 0;
+  for (; j + 8 <= n; j += 8) {
+    t0 += *reinterpret_cast<const CoinDenseVector *>(x + j) *
+      *reinterpret_cast<const CoinDenseVector *>(y + j);
+    t1 += *reinterpret_cast<const CoinDenseVector *>(x + j + 4) *
+      *reinterpret_cast<const CoinDenseVector *>(y + j + 4);
+  }
+  t0 += t1;
+  double value = (t0[0] + t0[1]) + (t0[2] + t0[3]);
+  for (; j < n; j++)
+    value += x[j] * y[j];
+  return value;
+}
+/* 0 plain, 1 AVX2 */
+static int
+CoinDenseSimdDetect()
+{
+  __builtin_cpu_init();
+  return (__builtin_cpu_supports("avx2") &&
+	  __builtin_cpu_supports("fma")) ? 1 : 0;
+}
+/* local static so initialization is done once even with threads */
+static inline int
+CoinDenseSimdType()
+{
+  static const int simdType = CoinDenseSimdDetect();
+  return simdType;
+}
+#endif
+// y -= a * x (x and y must not overlap)
+static inline void
+CoinDenseAxpy(int n, double a, const CoinFactorizationDouble * COIN_RESTRICT x,
+	      CoinFactorizationDouble * COIN_RESTRICT y)
+{
+#ifdef COIN_DENSE_SIMD
+  if (n >= 8 && CoinDenseSimdType()) {
+    CoinDenseAxpyAvx2(n, a, x, y);
+    return;
+  }
+#endif
+  for (int j = 0; j < n; j++)
+    y[j] -= a * x[j];
+}
+// returns x.y (x and y must not overlap)
+static inline CoinFactorizationDouble
+CoinDenseDot(int n, const CoinFactorizationDouble * COIN_RESTRICT x,
+	     const CoinFactorizationDouble * COIN_RESTRICT y)
+{
+#ifdef COIN_DENSE_SIMD
+  if (n >= 8 && CoinDenseSimdType())
+    return CoinDenseDotAvx2(n, x, y);
+#endif
+  CoinFactorizationDouble value = 0.0;
+  for (int j = 0; j < n; j++)
+    value += x[j] * y[j];
+  return value;
+}
 //:class CoinDenseFactorization.  Deals with Factorization and Updates
 //  CoinDenseFactorization.  Constructor
 CoinDenseFactorization::CoinDenseFactorization (  )
@@ -273,9 +360,8 @@ CoinDenseFactorization::factor ( )
 	  elementsA[iRow]=value;
 	}
 	CoinFactorizationDouble value = elementsA[i];
-	for (int j=i+1;j<numberRows_;j++) {
-	  elementsA[j] -= value * elements[j];
-	}
+	if (value)
+	  CoinDenseAxpy(numberRows_-i-1,value,elements+i+1,elementsA+i+1);
       }
     } else {
       status_=-1;
@@ -498,9 +584,8 @@ CoinDenseFactorization::updateColumn ( CoinIndexedVector * regionSparse,
     // base factorization L
     for (i=0;i<numberColumns_;i++) {
       double value = region[i];
-      for (int j=i+1;j<numberRows_;j++) {
-	region[j] -= value*elements[j];
-      }
+      if (value)
+	CoinDenseAxpy(numberRows_-i-1,value,elements+i+1,region+i+1);
       elements += numberRows_;
     }
     elements = elements_+numberRows_*numberRows_;
@@ -509,9 +594,8 @@ CoinDenseFactorization::updateColumn ( CoinIndexedVector * regionSparse,
       elements -= numberRows_;
       CoinFactorizationDouble value = region[i]*elements[i];
       region[i] = value;
-      for (int j=0;j<i;j++) {
-	region[j] -= value*elements[j];
-      }
+      if (value)
+	CoinDenseAxpy(i,value,elements,region);
     }
 #ifdef DENSE_CODE
   } else {
@@ -527,9 +611,8 @@ CoinDenseFactorization::updateColumn ( CoinIndexedVector * regionSparse,
   for (i=0;i<numberPivots_;i++) {
     int iPivot = pivotRow_[i+2*numberRows_];
     CoinFactorizationDouble value = region[iPivot]*elements[iPivot];
-    for (int j=0;j<numberRows_;j++) {
-      region[j] -= value*elements[j];
-    }
+    if (value)
+      CoinDenseAxpy(numberRows_,value,elements,region);
     region[iPivot] = value;
     elements += numberRows_;
   }
@@ -688,10 +771,10 @@ CoinDenseFactorization::updateTwoColumnsFT(CoinIndexedVector * regionSparse1,
       int iPivot = pivotRow_[i+2*numberRows_];
       CoinFactorizationDouble value2 = regionW2[iPivot]*elements[iPivot];
       CoinFactorizationDouble value3 = regionW3[iPivot]*elements[iPivot];
-      for (int j=0;j<numberRows_;j++) {
-	regionW2[j] -= value2*elements[j];
-	regionW3[j] -= value3*elements[j];
-      }
+      if (value2)
+	CoinDenseAxpy(numberRows_,value2,elements,regionW2);
+      if (value3)
+	CoinDenseAxpy(numberRows_,value3,elements,regionW3);
       regionW2[iPivot] = value2;
       regionW3[iPivot] = value3;
       elements += numberRows_;
@@ -820,12 +903,8 @@ CoinDenseFactorization::updateColumnTranspose ( CoinIndexedVector * regionSparse
     elements -= numberRows_;
     int iPivot = pivotRow_[i+2*numberRows_];
     CoinFactorizationDouble value = region[iPivot]; //*elements[iPivot];
-    for (int j=0;j<iPivot;j++) {
-      value -= region[j]*elements[j];
-    }
-    for (int j=iPivot+1;j<numberRows_;j++) {
-      value -= region[j]*elements[j];
-    }
+    value -= CoinDenseDot(iPivot,region,elements);
+    value -= CoinDenseDot(numberRows_-iPivot-1,region+iPivot+1,elements+iPivot+1);
     region[iPivot] = value*elements[iPivot];
   }
 #ifdef DENSE_CODE
@@ -836,9 +915,7 @@ CoinDenseFactorization::updateColumnTranspose ( CoinIndexedVector * regionSparse
     for (i=0;i<numberColumns_;i++) {
       //CoinFactorizationDouble value = region[i]*elements[i];
       CoinFactorizationDouble value = region[i];
-      for (int j=0;j<i;j++) {
-	value -= region[j]*elements[j];
-      }
+      value -= CoinDenseDot(i,region,elements);
       //region[i] = value;
       region[i] = value*elements[i];
       elements += numberRows_;
@@ -848,9 +925,7 @@ CoinDenseFactorization::updateColumnTranspose ( CoinIndexedVector * regionSparse
     for (i=numberColumns_-1;i>=0;i--) {
       elements -= numberRows_;
       CoinFactorizationDouble value = region[i];
-      for (int j=i+1;j<numberRows_;j++) {
-	value -= region[j]*elements[j];
-      }
+      value -= CoinDenseDot(numberRows_-i-1,region+i+1,elements+i+1);
       region[i] = value;
     }
 #ifdef DENSE_CODE
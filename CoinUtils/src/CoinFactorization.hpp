@@ -298,6 +298,19 @@ public:
   inline int numberDense() const
   { return numberDense_;}
 
+  /// Returns number of slacks at beginning of U
+  inline int numberSlacks() const
+  { return numberSlacks_;}
+
+  /** Returns number of singleton pivots (after slacks) taken before
+      first pivot which needed elimination - i.e. size of triangular part */
+  inline int numberTriangular() const
+  { return numberTriangular_;}
+
+  /// Returns size of bump (rows not slack or triangular)
+  inline int bumpSize() const
+  { return numberRows_-numberSlacks_-numberTriangular_;}
+
   /// Returns number in U area
   inline CoinBigIndex numberElementsU (  ) const {
     return lengthU_;
@@ -1301,6 +1314,9 @@ protected:
   /// Number of slacks at beginning of U
   int numberSlacks_;
 
+  /// Number of singleton pivots before bump
+  int numberTriangular_;
+
   /// Number in U
   int numberU_;
 
@@ -17,6 +17,34 @@
 #include "CoinPackedMatrix.hpp"
 #include "CoinFinite.hpp"
 #include <stdio.h>
+#if defined(__SSE2__) && !defined(COIN_NO_FACTOR_SIMD)
+#include <emmintrin.h>
+#define COIN_FACTOR_SIMD
+#endif
+/* Returns position of value in index[start,end) - value must be there.
+   Singleton pivots search long columns (linking columns) once for each
+   row they cover so scan those eight at a time */
+static inline CoinBigIndex
+findInIndex(const int * index, CoinBigIndex start, CoinBigIndex end,
+	    int value)
+{
+  CoinBigIndex k = start;
+#ifdef COIN_FACTOR_SIMD
+  __m128i look = _mm_set1_epi32(value);
+  for ( ; k + 8 <= end; k += 8) {
+    __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i *>(index+k));
+    __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i *>(index+k+4));
+    __m128i hit = _mm_or_si128(_mm_cmpeq_epi32(a,look),_mm_cmpeq_epi32(b,look));
+    if (_mm_movemask_epi8(hit))
+      break;
+  }
+#endif
+  while ( index[k] != value ) {
+    k++;
+  }
+  assert ( k < end );
+  return k;
+}
 //:class CoinFactorization.  Deals with Factorization and Updates
 //  CoinFactorization.  Constructor
 CoinFactorization::CoinFactorization (  )
@@ -123,6 +151,7 @@ void CoinFactorization::gutsOfDestructor(int type)
   factorElements_ = 0;
   status_ = -1;
   numberSlacks_ = 0;
+  numberTriangular_ = 0;
   numberU_ = 0;
   maximumU_=0;
   lengthU_ = 0;
@@ -163,6 +192,7 @@ void CoinFactorization::gutsOfInitialize(int type)
     status_ = -1;
     numberPivots_ = 0;
     numberSlacks_ = 0;
+    numberTriangular_ = 0;
     numberU_ = 0;
     maximumU_=0;
     lengthU_ = 0;
@@ -1099,16 +1129,11 @@ CoinFactorization::pivotRowSingleton ( int pivotRow,
   CoinBigIndex endColumn = startColumn + numberDoColumn + 1;
   CoinBigIndex pivotRowPosition = startColumn;
   int * indexRowU = indexRowU_.array();
-  int iRow = indexRowU[pivotRowPosition];
   CoinBigIndex * startRowU = startRowU_.array();
   int * nextRow = nextRow_.array();
   int * lastRow = lastRow_.array();
 
-  while ( iRow != pivotRow ) {
-    pivotRowPosition++;
-    iRow = indexRowU[pivotRowPosition];
-  }				/* endwhile */
-  assert ( pivotRowPosition < endColumn );
+  pivotRowPosition = findInIndex(indexRowU,pivotRowPosition,endColumn,pivotRow);
   //store column in L, compress in U and take column out
   CoinBigIndex l = lengthL_;
 
@@ -1143,12 +1168,8 @@ CoinFactorization::pivotRowSingleton ( int pivotRow,
     CoinBigIndex start = startRowU[iRow];
     int iNumberInRow = numberInRow[iRow];
     CoinBigIndex end = start + iNumberInRow;
-    CoinBigIndex where = start;
+    CoinBigIndex where = findInIndex(indexColumnU,start,end,pivotColumn);
 
-    while ( indexColumnU[where] != pivotColumn ) {
-      where++;
-    }				/* endwhile */
-    assert ( where < end );
     indexColumnU[where] = indexColumnU[end - 1];
     iNumberInRow--;
     numberInRow[iRow] = iNumberInRow;
@@ -1165,12 +1186,8 @@ CoinFactorization::pivotRowSingleton ( int pivotRow,
     CoinBigIndex start = startRowU[iRow];
     int iNumberInRow = numberInRow[iRow];
     CoinBigIndex end = start + iNumberInRow;
-    CoinBigIndex where = start;
+    CoinBigIndex where = findInIndex(indexColumnU,start,end,pivotColumn);
 
-    while ( indexColumnU[where] != pivotColumn ) {
-      where++;
-    }				/* endwhile */
-    assert ( where < end );
     indexColumnU[where] = indexColumnU[end - 1];
     iNumberInRow--;
     numberInRow[iRow] = iNumberInRow;
@@ -1252,19 +1269,14 @@ CoinFactorization::pivotColumnSingleton ( int pivotRow,
       //move pivot row element
       if ( number ) {
 	CoinBigIndex start = startColumnU[iColumn];
-	CoinBigIndex pivot = start;
-	int iRow = indexRowU[pivot];
-	while ( iRow != pivotRow ) {
-	  pivot++;
-	  iRow = indexRowU[pivot];
-	}
-        assert (pivot < startColumnU[iColumn] +
-                numberInColumn[iColumn]);
+	CoinBigIndex pivot = findInIndex(indexRowU,start,
+					 start+numberInColumn[iColumn],
+					 pivotRow);
 	if ( pivot != start ) {
 	  //move largest one up
 	  CoinFactorizationDouble value = elementU[start];
 
-	  iRow = indexRowU[start];
+	  int iRow = indexRowU[start];
 	  elementU[start] = elementU[pivot];
 	  indexRowU[start] = indexRowU[pivot];
 	  elementU[pivot] = elementU[start + 1];
@@ -1800,6 +1812,9 @@ CoinFactorization::cleanup (  )
     if (numberDense_)
       std::cout<<" plus "<<numberDense_*numberDense_<<" from "<<numberDense_<<" dense rows";
     std::cout<<std::endl;
+    std::cout<<"        "<<numberSlacks_<<" slacks, "<<numberTriangular_
+	     <<" triangular, bump of "<<numberRows_-numberSlacks_-numberTriangular_
+	     <<std::endl;
   }
   // and add L and dense
   totalElements_ += numberDense_*numberDense_+lengthL_;
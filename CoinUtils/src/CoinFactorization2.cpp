@@ -128,6 +128,7 @@ CoinFactorization::factorSparseSmall (  )
     CoinFillN (  markRow, numberRows_, static_cast<unsigned short> (SMALL_UNSET));
   }
   numberSlacks_ = numberGoodU_;
+  numberTriangular_ = -1;
   int *nextCount = nextCount_.array();
   int *firstCount = firstCount_.array();
   CoinBigIndex *startRow = startRowU_.array();
@@ -334,6 +335,9 @@ CoinFactorization::factorSparseSmall (  )
       totalElements_ -= ( numberDoRow + numberDoColumn + 1 );
       if ( numberDoColumn > 0 ) {
 	if ( numberDoRow > 0 ) {
+	  // first pivot needing elimination ends triangular part
+	  if (numberTriangular_<0)
+	    numberTriangular_ = numberGoodU_-numberSlacks_;
 	  if ( numberDoColumn > 1 ) {
 	    //  if (1) {
 	    //need to adjust more for cache and SMP
@@ -470,6 +474,8 @@ CoinFactorization::factorSparseSmall (  )
       count++;
     } 
   }				/* endwhile */
+  if (numberTriangular_<0)
+    numberTriangular_ = numberGoodU_-numberSlacks_;
   workArea_.conditionalDelete() ;
   workArea2_.conditionalDelete() ;
   return status;
@@ -1067,6 +1073,7 @@ CoinFactorization::factorSparseLarge (  )
     CoinFillN ( markRow, numberRows_, COIN_INT_MAX-10+1);
   }
   numberSlacks_ = numberGoodU_;
+  numberTriangular_ = -1;
   int *nextCount = nextCount_.array();
   int *firstCount = firstCount_.array();
   CoinBigIndex *startRow = startRowU_.array();
@@ -1270,6 +1277,9 @@ CoinFactorization::factorSparseLarge (  )
         totalElements_ -= ( numberDoRow + numberDoColumn + 1 );
         if ( numberDoColumn > 0 ) {
           if ( numberDoRow > 0 ) {
+            // first pivot needing elimination ends triangular part
+            if (numberTriangular_<0)
+              numberTriangular_ = numberGoodU_-numberSlacks_;
             if ( numberDoColumn > 1 ) {
               //  if (1) {
               //need to adjust more for cache and SMP
@@ -1408,6 +1418,8 @@ CoinFactorization::factorSparseLarge (  )
       count++;
     } 
   }				/* endwhile */
+  if (numberTriangular_<0)
+    numberTriangular_ = numberGoodU_-numberSlacks_;
   workArea_.conditionalDelete() ;
   workArea2_.conditionalDelete() ;
   return status;
@@ -2451,6 +2451,7 @@ void CoinFactorization::gutsOfCopy(const CoinFactorization &other)
   biggerDimension_ = other.biggerDimension_;
   relaxCheck_ = other.relaxCheck_;
   numberSlacks_ = other.numberSlacks_;
+  numberTriangular_ = other.numberTriangular_;
   numberU_ = other.numberU_;
   maximumU_=other.maximumU_;
   lengthU_ = other.lengthU_;
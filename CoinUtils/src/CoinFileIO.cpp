@@ -16,6 +16,14 @@
 #include <vector>
 #include <cstring>
 
+#ifdef COINUTILS_PTHREADS
+#include <pthread.h>
+// Compressed input is decompressed on a separate thread into a ring of
+// this many blocks of this size, so decompression overlaps parsing
+#define COIN_READ_AHEAD_BLOCKS 4
+#define COIN_READ_AHEAD_SIZE 262144
+#endif
+
 // ------ CoinFileIOBase -------
 
 CoinFileIOBase::CoinFileIOBase (const std::string &fileName):
@@ -86,6 +94,9 @@ private:
 // zlib's gzgets is extremely slow). It's subclasses only have to implement
 // the readRaw method, while the read and gets methods are handled by this
 // class using an internal buffer.
+// If COINUTILS_PTHREADS is defined readRaw is called on a read-ahead
+// thread, so subclasses must call stopReadAhead in their destructors
+// before closing whatever readRaw uses.
 class CoinGetslessFileInput: public CoinFileInput
 {
 public:
@@ -94,9 +105,30 @@ public:
     dataBuffer_ (8*1024), 
     dataStart_ (&dataBuffer_[0]), 
     dataEnd_ (&dataBuffer_[0])
-  {}
+#ifdef COINUTILS_PTHREADS
+    , started_ (false),
+    stop_ (false),
+    finished_ (false),
+    numberFull_ (0),
+    produce_ (0),
+    consume_ (0),
+    offset_ (0)
+#endif
+  {
+#ifdef COINUTILS_PTHREADS
+    pthread_mutex_init (&mutex_, NULL);
+    pthread_cond_init (&condition_, NULL);
+#endif
+  }
 
-  virtual ~CoinGetslessFileInput () {}
+  virtual ~CoinGetslessFileInput ()
+  {
+#ifdef COINUTILS_PTHREADS
+    stopReadAhead ();
+    pthread_cond_destroy (&condition_);
+    pthread_mutex_destroy (&mutex_);
+#endif
+  }
 
   virtual int read (void *buffer, int size)
   {
@@ -128,8 +160,14 @@ public:
 
     // If we require more data, use readRaw.
     // We don't use the buffer here, as readRaw is ecpected to be efficient.
-    if (size > 0)
-      r += readRaw (dest, size);
+    while (size > 0) {
+      int count = fetchRaw (dest, size);
+      if (count <= 0)
+	break;
+      dest += count;
+      size -= count;
+      r += count;
+    }
 
     return r;
   }
@@ -150,7 +188,7 @@ public:
 	if (dataStart_ == dataEnd_)
 	  {
 	    dataStart_ = dataEnd_ = &dataBuffer_[0];
-	    int count = readRaw (dataStart_, static_cast<int>(dataBuffer_.size ()));
+	    int count = fetchRaw (dataStart_, static_cast<int>(dataBuffer_.size ()));
 
 	    // at EOF?
 	    if (count <= 0) 
@@ -190,10 +228,118 @@ protected:
   // size bytes. Return value is the number of bytes written (0 indicates EOF).
   virtual int readRaw (void *buffer, int size) = 0;
 
+#ifdef COINUTILS_PTHREADS
+  // Stops read-ahead thread (if running).  Must be called by
+  // destructor of subclass before readRaw becomes invalid.
+  void stopReadAhead ()
+  {
+    if (started_) {
+      pthread_mutex_lock (&mutex_);
+      stop_ = true;
+      pthread_cond_broadcast (&condition_);
+      pthread_mutex_unlock (&mutex_);
+      pthread_join (thread_, NULL);
+      started_ = false;
+    }
+  }
+#else
+  inline void stopReadAhead () {}
+#endif
+
 private:
+#ifdef COINUTILS_PTHREADS
+  // Gets up to size bytes from the blocks filled by read-ahead thread.
+  // Returns 0 at EOF.
+  int fetchRaw (char *buffer, int size)
+  {
+    if (!started_) {
+      if (finished_)
+	return 0;
+      blocks_.resize (COIN_READ_AHEAD_BLOCKS*COIN_READ_AHEAD_SIZE);
+      if (pthread_create (&thread_, NULL, readAhead, this)) {
+	// no thread - read directly
+	return readRaw (buffer, size);
+      }
+      started_ = true;
+    }
+    pthread_mutex_lock (&mutex_);
+    while (!numberFull_ && !finished_)
+      pthread_cond_wait (&condition_, &mutex_);
+    int numberFull = numberFull_;
+    pthread_mutex_unlock (&mutex_);
+    if (!numberFull)
+      return 0;
+    // consume_ block is ours until numberFull_ is decreased
+    int amount = CoinMin (size, blockCount_[consume_] - offset_);
+    CoinMemcpyN (&blocks_[consume_*COIN_READ_AHEAD_SIZE + offset_], 
+		 amount, buffer);
+    offset_ += amount;
+    if (offset_ == blockCount_[consume_]) {
+      offset_ = 0;
+      consume_ = (consume_ + 1) % COIN_READ_AHEAD_BLOCKS;
+      pthread_mutex_lock (&mutex_);
+      numberFull_--;
+      pthread_cond_broadcast (&condition_);
+      pthread_mutex_unlock (&mutex_);
+    }
+    return amount;
+  }
+
+  // Body of read-ahead thread - fills free blocks until EOF or stopped
+  static void *readAhead (void *arg)
+  {
+    CoinGetslessFileInput *input = static_cast<CoinGetslessFileInput *>(arg);
+    for (;;) {
+      pthread_mutex_lock (&input->mutex_);
+      while (input->numberFull_ == COIN_READ_AHEAD_BLOCKS && !input->stop_)
+	pthread_cond_wait (&input->condition_, &input->mutex_);
+      bool stop = input->stop_;
+      pthread_mutex_unlock (&input->mutex_);
+      if (stop)
+	break;
+      // produce_ block is free - decompress into it without lock
+      int which = input->produce_;
+      int count = input->readRaw (&input->blocks_[which*COIN_READ_AHEAD_SIZE],
+				  COIN_READ_AHEAD_SIZE);
+      pthread_mutex_lock (&input->mutex_);
+      if (count <= 0) {
+	input->finished_ = true;
+      } else {
+	input->blockCount_[which] = count;
+	input->produce_ = (which + 1) % COIN_READ_AHEAD_BLOCKS;
+	input->numberFull_++;
+      }
+      pthread_cond_broadcast (&input->condition_);
+      pthread_mutex_unlock (&input->mutex_);
+      if (count <= 0)
+	break;
+    }
+    return NULL;
+  }
+#else
+  inline int fetchRaw (char *buffer, int size)
+  {
+    return readRaw (buffer, size);
+  }
+#endif
+
   std::vector<char> dataBuffer_; // memory used for buffering 
   char *dataStart_; // pointer to currently buffered data
   char *dataEnd_; // pointer to "one behind last data element"
+#ifdef COINUTILS_PTHREADS
+  pthread_t thread_; // read-ahead thread
+  pthread_mutex_t mutex_; // protects numberFull_, stop_ and finished_
+  pthread_cond_t condition_; // signalled when any of those change
+  bool started_; // true if thread_ running (or not yet joined)
+  bool stop_; // tells thread to finish
+  bool finished_; // thread has reached EOF
+  std::vector<char> blocks_; // ring of blocks
+  int blockCount_[COIN_READ_AHEAD_BLOCKS]; // bytes in each full block
+  int numberFull_; // number of full blocks
+  int produce_; // next block thread will fill
+  int consume_; // block being read from
+  int offset_; // bytes already taken from consume_ block
+#endif
 };
 
 
@@ -224,6 +370,7 @@ public:
 
   virtual ~CoinGzipFileInput ()
   {
+    stopReadAhead ();
     if (gzf_ != 0)
       gzclose (gzf_);
   }
@@ -271,6 +418,7 @@ public:
 
   virtual ~CoinBzip2FileInput ()
   {
+    stopReadAhead ();
     int bzError = BZ_OK;
     if (bzf_ != 0)
       BZ2_bzReadClose (&bzError, bzf_);
@@ -30,6 +30,11 @@ using namespace std;
 
 //#define LPIO_DEBUG
 
+// Size of block read from Lp file at a time
+#define COIN_LPIO_BUFFER_SIZE 262144
+// Size of buffer given to stdio when writing Lp file
+#define COIN_LPIO_WRITE_BUFFER_SIZE 1048576
+
 /************************************************************************/
 
 CoinLpIO::CoinLpIO() :
@@ -55,7 +60,10 @@ CoinLpIO::CoinLpIO() :
   numberAcross_(10),
   epsilon_(1e-5),
   decimals_(5),
-  objName_(NULL)
+  objName_(NULL),
+  inputBuffer_(NULL),
+  inputPosition_(0),
+  inputEnd_(0)
 {
   card_previous_names_[0] = 0;
   card_previous_names_[1] = 0;
@@ -100,7 +108,10 @@ CoinLpIO::CoinLpIO(const CoinLpIO& rhs)
     infinity_(COIN_DBL_MAX),
     numberAcross_(10),
     epsilon_(1e-5),
-    objName_(NULL)
+    objName_(NULL),
+    inputBuffer_(NULL),
+    inputPosition_(0),
+    inputEnd_(0)
 {
     card_previous_names_[0] = 0;
     card_previous_names_[1] = 0;
@@ -244,6 +255,7 @@ CoinLpIO::~CoinLpIO() {
   stopHash(0);
   stopHash(1);
   freeAll();
+  delete [] inputBuffer_;
   if (defaultHandler_) {
     delete handler_;
     handler_ = NULL; 
@@ -865,8 +877,12 @@ CoinLpIO::writeLp(const char *filename, const double epsilon,
     sprintf(str,"### ERROR: unable to open file %s\n", filename);
     throw CoinError(str, "writeLP", "CoinLpIO", __FILE__, __LINE__);
   }
+  // one large buffer so output is written in big blocks
+  char * outputBuffer = new char [COIN_LPIO_WRITE_BUFFER_SIZE];
+  setvbuf(fp, outputBuffer, _IOFBF, COIN_LPIO_WRITE_BUFFER_SIZE);
   int nerr = writeLp(fp, epsilon, numberAcross, decimals, useRowNames);
   fclose(fp);
+  delete [] outputBuffer;
   return(nerr);
 }
 
@@ -893,8 +909,12 @@ CoinLpIO::writeLp(const char *filename, const bool useRowNames)
     sprintf(str,"### ERROR: unable to open file %s\n", filename);
     throw CoinError(str, "writeLP", "CoinLpIO", __FILE__, __LINE__);
   }
+  // one large buffer so output is written in big blocks
+  char * outputBuffer = new char [COIN_LPIO_WRITE_BUFFER_SIZE];
+  setvbuf(fp, outputBuffer, _IOFBF, COIN_LPIO_WRITE_BUFFER_SIZE);
   int nerr = writeLp(fp, useRowNames);
   fclose(fp);
+  delete [] outputBuffer;
   return(nerr);
 }
 
@@ -1157,7 +1177,7 @@ CoinLpIO::find_obj(FILE *fp) const {
     scan_next(buff, fp);
     lbuff = strlen(buff);
     
-    if(feof(fp)) {
+    if(at_eof(fp)) {
       char str[8192];
       sprintf(str,"### ERROR: Unable to locate objective function\n");
       throw CoinError(str, "find_obj", "CoinLpIO", __FILE__, __LINE__);
@@ -1264,33 +1284,118 @@ CoinLpIO::is_comment(const char *buff) const {
 void
 CoinLpIO::skip_comment(char *buff, FILE *fp) const {
 
-  while(strcspn(buff, "\n") == strlen(buff)) { // end of line not read yet
-    if(feof(fp)) {
-      char str[8192];
-      sprintf(str,"### ERROR: end of file reached while skipping comment\n");
-      throw CoinError(str, "skip_comment", "CoinLpIO", __FILE__, __LINE__);
+  // rest of the line is comment
+  while(1) {
+    if(inputPosition_ == inputEnd_) {
+      if(ferror(fp)) {
+	char str[8192];
+	sprintf(str,"### ERROR: error while skipping comment\n");
+	throw CoinError(str, "skip_comment", "CoinLpIO", __FILE__, __LINE__);
+      }
+      if(!fill_buffer(fp)) {
+	char str[8192];
+	sprintf(str,"### ERROR: end of file reached while skipping comment\n");
+	throw CoinError(str, "skip_comment", "CoinLpIO", __FILE__, __LINE__);
+      }
     }
-    if(ferror(fp)) {
-      char str[8192];
-      sprintf(str,"### ERROR: error while skipping comment\n");
-      throw CoinError(str, "skip_comment", "CoinLpIO", __FILE__, __LINE__);
+    const char * found = static_cast<const char *>
+      (memchr(inputBuffer_ + inputPosition_, '\n', inputEnd_ - inputPosition_));
+    if(found) {
+      inputPosition_ = static_cast<int>(found - inputBuffer_) + 1;
+      break;
     }
-    char * x=fgets(buff, sizeof(buff), fp);    
-    if (!x)
-      throw("bad fgets");
+    inputPosition_ = inputEnd_;
   } 
 } /* skip_comment */
 
+/*************************************************************************/
+int
+CoinLpIO::fill_buffer(FILE *fp) const {
+
+  if(!inputBuffer_) {
+    inputBuffer_ = new char[COIN_LPIO_BUFFER_SIZE];
+    inputPosition_ = 0;
+    inputEnd_ = 0;
+  }
+  int left = inputEnd_ - inputPosition_;
+  if(left && inputPosition_) {
+    memmove(inputBuffer_, inputBuffer_ + inputPosition_, left);
+  }
+  inputPosition_ = 0;
+  inputEnd_ = left + static_cast<int>(fread(inputBuffer_ + left, 1, 
+					    COIN_LPIO_BUFFER_SIZE - left, fp));
+  return(inputEnd_);
+} /* fill_buffer */
+
+/*************************************************************************/
+int
+CoinLpIO::read_token(char *buff, FILE *fp) const {
+
+  // skip white space
+  while(1) {
+    if((inputPosition_ == inputEnd_) && (!fill_buffer(fp))) {
+      buff[0] = '\0';
+      return(0);
+    }
+    if(!isspace(static_cast<unsigned char> (inputBuffer_[inputPosition_]))) {
+      break;
+    }
+    inputPosition_++;
+  }
+  int length = 0;
+  while(1) {
+    if((inputPosition_ == inputEnd_) && (!fill_buffer(fp))) {
+      break;
+    }
+    char c = inputBuffer_[inputPosition_];
+    if(isspace(static_cast<unsigned char> (c))) {
+      break;
+    }
+    if(length == 1023) {
+      char str[8192];
+      buff[length] = '\0';
+      sprintf(str,"### ERROR: string too long: %s\n", buff);
+      throw CoinError(str, "read_token", "CoinLpIO", __FILE__, __LINE__);
+    }
+    buff[length++] = c;
+    inputPosition_++;
+  }
+  buff[length] = '\0';
+  return(1);
+} /* read_token */
+
+/*************************************************************************/
+int
+CoinLpIO::at_eof(FILE *fp) const {
+
+  if((inputPosition_ == inputEnd_) && (!fill_buffer(fp))) {
+    return(1);
+  }
+  return(0);
+} /* at_eof */
+
+/*************************************************************************/
+void
+CoinLpIO::unread_buffer(FILE *fp) const {
+
+  if(inputEnd_ > inputPosition_) {
+    // best effort - fp may not be seekable
+    fseek(fp, inputPosition_ - inputEnd_, SEEK_CUR);
+  }
+  inputPosition_ = 0;
+  inputEnd_ = 0;
+} /* unread_buffer */
+
 /*************************************************************************/
 void
 CoinLpIO::scan_next(char *buff, FILE *fp) const {
 
-  int x=fscanf(fp, "%s", buff);
+  int x=read_token(buff, fp);
   if (x<=0)
     throw("bad fscanf");
   while(is_comment(buff)) {
     skip_comment(buff, fp);
-    x=fscanf(fp, "%s", buff);
+    x=read_token(buff, fp);
     if (x<=0)
       throw("bad fscanf");
   }
@@ -1405,7 +1510,7 @@ CoinLpIO::read_monom_obj(FILE *fp, double *coeff, char **name, int *cnt,
 
   scan_next(buff, fp);
 
-  if(feof(fp)) {
+  if(at_eof(fp)) {
     char str[8192];
     sprintf(str,"### ERROR: Unable to read objective function\n");
     throw CoinError(str, "read_monom_obj", "CoinLpIO", __FILE__, __LINE__);
@@ -1592,7 +1697,7 @@ void
 CoinLpIO::realloc_col(double **collow, double **colup, char **is_int,
 		      int *maxcol) const {
   
-  *maxcol += 100;
+  *maxcol = 2 * (*maxcol) + 100;
   *collow = reinterpret_cast<double *> (realloc ((*collow), (*maxcol+1) * sizeof(double)));
   *colup = reinterpret_cast<double *> (realloc ((*colup), (*maxcol+1) * sizeof(double)));
   *is_int = reinterpret_cast<char *> (realloc ((*is_int), (*maxcol+1) * sizeof(char)));
@@ -1627,7 +1732,7 @@ CoinLpIO::read_row(FILE *fp, char *buff,
 
     scan_next(start_str, fp);
 
-    if(feof(fp)) {
+    if(at_eof(fp)) {
       char str[8192];
       sprintf(str,"### ERROR: Unable to read row monomial\n");
       throw CoinError(str, "read_monom_row", "CoinLpIO", __FILE__, __LINE__);
@@ -1740,6 +1845,9 @@ CoinLpIO::readLp(FILE* fp)
 
   int i;
 
+  // start with empty buffer
+  inputPosition_ = 0;
+  inputEnd_ = 0;
   objsense = find_obj(fp);
 
   int read_st = 0;
@@ -1755,7 +1863,7 @@ CoinLpIO::readLp(FILE* fp)
   cnt_coeff = cnt_obj;
 
   if(read_st == 2) {
-    int x=fscanf(fp, "%s", buff);
+    int x=read_token(buff, fp);
     if (x<=0)
       throw("bad fscanf");
     size_t lbuff = strlen(buff);
@@ -2046,7 +2154,7 @@ CoinLpIO::readLp(FILE* fp)
       }
       break;
       
-    case 4: done = 1; break;
+    case 4: done = 1; unread_buffer(fp); break;
       
     default: 
       char str[8192];
@@ -2227,33 +2335,22 @@ CoinLpIO::print() const {
 
 
 /*************************************************************************/
-// Hash functions slightly modified from CoinMpsIO.cpp
+// Hash function for names
 
 namespace {
-  const int mmult[] = {
-    262139, 259459, 256889, 254291, 251701, 249133, 246709, 244247,
-    241667, 239179, 236609, 233983, 231289, 228859, 226357, 223829,
-    221281, 218849, 216319, 213721, 211093, 208673, 206263, 203773,
-    201233, 198637, 196159, 193603, 191161, 188701, 186149, 183761,
-    181303, 178873, 176389, 173897, 171469, 169049, 166471, 163871,
-    161387, 158941, 156437, 153949, 151531, 149159, 146749, 144299,
-    141709, 139369, 136889, 134591, 132169, 129641, 127343, 124853,
-    122477, 120163, 117757, 115361, 112979, 110567, 108179, 105727,
-    103387, 101021, 98639, 96179, 93911, 91583, 89317, 86939, 84521,
-    82183, 79939, 77587, 75307, 72959, 70793, 68447, 66103
-  };
  int compute_hash(const char *name, int maxsiz, int length)
 {
   
-  int n = 0;
+  // FNV-1a - names such as x1234 which only differ in a few
+  // digits are spread over the whole table
+  unsigned int n = 2166136261u;
   int j;
 
   for ( j = 0; j < length; ++j ) {
-    int iname = name[j];
-
-    n += mmult[j] * iname;
+    n ^= static_cast<unsigned char> (name[j]);
+    n *= 16777619u;
   }
-  return ( abs ( n ) % maxsiz );	/* integer abs */
+  return ( static_cast<int> (n % static_cast<unsigned int> (maxsiz)) );
 }
 } // end file-local namespace
 
@@ -566,6 +566,16 @@ protected:
   /// Objective function name
   char *objName_;
 
+  /** Block of file being read so tokens can be picked up without a
+      call to fscanf for each one.  Allocated on first read. */
+  mutable char *inputBuffer_;
+
+  /// Position of first unread character in inputBuffer_
+  mutable int inputPosition_;
+
+  /// Number of valid characters in inputBuffer_
+  mutable int inputEnd_;
+
   /** Row names (including objective function name) 
       and column names when stopHash() for the corresponding 
       section was last called or for initial names (deemed invalid) 
@@ -661,6 +671,20 @@ protected:
   /// Put in buff the next string that is not part of a comment
   void scan_next(char *buff, FILE *fp) const;
 
+  /// Move unread characters to start of inputBuffer_ and fill the rest
+  /// from fp. Return the number of unread characters.
+  int fill_buffer(FILE *fp) const;
+
+  /// Put in buff the next string delimited by white space.
+  /// Return 0 if end of file was reached first.
+  int read_token(char *buff, FILE *fp) const;
+
+  /// Return 1 if all of fp has been read (as feof() after fscanf()).
+  int at_eof(FILE *fp) const;
+
+  /// Give back to fp the characters read into inputBuffer_ but not used
+  void unread_buffer(FILE *fp) const;
+
   /// Return 1 if buff is the keyword "free" or one of its variants.
   /// Return 0 otherwise.
   int is_free(const char *buff) const;
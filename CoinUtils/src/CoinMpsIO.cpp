@@ -29,14 +29,11 @@
 
 namespace {
 
-  const double fraction[]=
-  {1.0,1.0e-1,1.0e-2,1.0e-3,1.0e-4,1.0e-5,1.0e-6,1.0e-7,1.0e-8,
-   1.0e-9,1.0e-10,1.0e-11,1.0e-12,1.0e-13,1.0e-14,1.0e-15,1.0e-16,
-   1.0e-17,1.0e-18,1.0e-19,1.0e-20,1.0e-21,1.0e-22,1.0e-23};
-
-  const double exponent[]=
-  {1.0e-9,1.0e-8,1.0e-7,1.0e-6,1.0e-5,1.0e-4,1.0e-3,1.0e-2,1.0e-1,
-   1.0,1.0e1,1.0e2,1.0e3,1.0e4,1.0e5,1.0e6,1.0e7,1.0e8,1.0e9};
+  // Powers of ten which are exact as doubles
+  const double exactPower[]=
+  {1.0,1.0e1,1.0e2,1.0e3,1.0e4,1.0e5,1.0e6,1.0e7,1.0e8,1.0e9,1.0e10,
+   1.0e11,1.0e12,1.0e13,1.0e14,1.0e15,1.0e16,1.0e17,1.0e18,1.0e19,1.0e20,
+   1.0e21,1.0e22};
 
 } // end file-local namespace
 double CoinMpsCardReader::osi_strtod(char * ptr, char ** output, int type) 
@@ -60,6 +57,7 @@ double CoinMpsCardReader::osi_strtod(char * ptr, char ** output, int type)
     // more white space
     while (*ptr==' '||*ptr=='\t')
       ptr++;
+    char * number = ptr;
     char thisChar=0;
     while (value<1.0e30) {
       thisChar = *ptr;
@@ -70,26 +68,25 @@ double CoinMpsCardReader::osi_strtod(char * ptr, char ** output, int type)
 	break;
     }
     if (value<1.0e30) {
+      // digits of fraction are added to value and scaled once at end
+      int nfrac=0;
       if (thisChar=='.') {
 	// do fraction
-	double value2 = 0.0;
-	int nfrac=0;
 	while (nfrac<24) {
 	  thisChar = *ptr;
 	  ptr++;
 	  if (thisChar>='0'&&thisChar<='9') {
-	    value2 = value2*10.0+thisChar-'0';
+	    value = value*10.0+thisChar-'0';
 	    nfrac++;
 	  } else {
 	    break;
 	  }
 	}
-	if (nfrac<24) {
-	  value += value2*fraction[nfrac];
-	} else {
+	if (nfrac>=24) {
 	  thisChar='x'; // force error
 	}
       }
+      int power = -nfrac;
       if (thisChar=='e'||thisChar=='E') {
 	// exponent
 	int sign2=1;
@@ -110,20 +107,33 @@ double CoinMpsCardReader::osi_strtod(char * ptr, char ** output, int type)
 	    break;
 	  }
 	}
-	if (value3<300) {
-	  value3 *= sign2; // power of 10
-	  if (abs(value3)<10) {
-	    // do most common by lookup (for accuracy?)
-	    value *= exponent[value3+9];
-	  } else {
-	    value *= pow(10.0,value3);
-	  }
+	if (value3<400) {
+	  // (exact writing of very small numbers may go below -308)
+	  power += value3*sign2; // power of 10
 	} else if (sign2<0.0) {
 	  value = 0.0; // force zero
+	  power = 0;
+	  nfrac = 0;
 	} else {
 	  value = COIN_DBL_MAX;
+	  power = 0;
+	  nfrac = 0;
 	}
       } 
+      if (power) {
+	if (value<9007199254740992.0&&power>=-22&&power<=22) {
+	  // value and power exact so one operation gives correctly
+	  // rounded result
+	  if (power>0)
+	    value *= exactPower[power];
+	  else
+	    value /= exactPower[-power];
+	} else {
+	  value = CoinMin(strtod(number,NULL),COIN_DBL_MAX);
+	}
+      } else if (value>=9007199254740992.0&&nfrac) {
+	value = strtod(number,NULL);
+      }
       if (thisChar==0||thisChar=='\t'||thisChar==' ') {
 	// okay
 	*output=ptr;
@@ -3532,7 +3542,8 @@ int
 CoinMpsIO::readBasis(const char *filename, const char *extension ,
 		     double * solution, unsigned char * rowStatus, unsigned char * columnStatus,
 		     const std::vector<std::string> & colnames,int numberColumns,
-		     const std::vector<std::string> & rownames, int numberRows)
+		     const std::vector<std::string> & rownames, int numberRows,
+		     const CoinMpsNameIndex * nameIndex)
 {
   // Deal with filename - +1 if new, 0 if same as before, -1 if error
   CoinFileInput *input = 0;
@@ -3576,6 +3587,8 @@ CoinMpsIO::readBasis(const char *filename, const char *extension ,
   if (rownames.size()!=static_cast<unsigned int> (numberRows_)||
       colnames.size()!=static_cast<unsigned int> (numberColumns_)) {
     gotNames = false;
+  } else if (nameIndex) {
+    gotNames=true;
   } else {
     gotNames=true;
     numberHash_[0]=numberRows_;
@@ -3604,7 +3617,8 @@ CoinMpsIO::readBasis(const char *filename, const char *extension ,
     // Get type and column number
     int iColumn;
     if (gotNames) {
-      iColumn = findHash (cardReader_->columnName(),1);
+      const char * name = cardReader_->columnName();
+      iColumn = nameIndex ? nameIndex->index(name,1) : findHash (name,1);
     } else {
       // few checks 
       char check;
@@ -3626,7 +3640,8 @@ CoinMpsIO::readBasis(const char *filename, const char *extension ,
 	columnStatus[iColumn]= basic;
 	// get row number
 	if (gotNames) {
-	  iRow = findHash (cardReader_->rowName(),0);
+	  const char * name = cardReader_->rowName();
+	  iRow = nameIndex ? nameIndex->index(name,0) : findHash (name,0);
 	} else {
 	  // few checks 
 	  char check;
@@ -3643,7 +3658,8 @@ CoinMpsIO::readBasis(const char *filename, const char *extension ,
 	columnStatus[iColumn]= basic;
 	// get row number
 	if (gotNames) {
-	  iRow = findHash (cardReader_->rowName(),0);
+	  const char * name = cardReader_->rowName();
+	  iRow = nameIndex ? nameIndex->index(name,0) : findHash (name,0);
 	} else {
 	  // few checks 
 	  char check;
@@ -3667,7 +3683,7 @@ CoinMpsIO::readBasis(const char *filename, const char *extension ,
       }
     }
   }
-  if (gotNames) {
+  if (gotNames&&!nameIndex) {
     stopHash ( 0 );
     stopHash ( 1 );
     free(names_[0]);
@@ -3750,13 +3766,34 @@ CoinConvertDouble(int section, int formatType, double value, char outputValue[24
     bool stripZeros=true;
     if (fabs(value)<1.0e40) {
       int power10, decimal;
+      if (value==floor(value)&&
+	  ((value>=1.0&&value<1.0e9)||(value<=-1.0&&value>-1.0e7))) {
+	// integer - same as below without sprintf
+	char digits[12];
+	int n=0;
+	int iValue = static_cast<int> (fabs(value));
+	while (iValue) {
+	  digits[n++] = static_cast<char>('0'+iValue%10);
+	  iValue /= 10;
+	}
+	char * put = outputValue;
+	if (value<0.0) {
+	  *put++ = ' ';
+	  *put++ = '-';
+	}
+	while (n)
+	  *put++ = digits[--n];
+	*put++ = '.';
+	while (put<outputValue+12)
+	  *put++ = ' ';
+	outputValue[12]='\0';
+	return;
+      }
       if (value>=0.0) {
 	power10 =static_cast<int> (log10(value));
 	if (power10<9&&power10>-4) {
 	  decimal = CoinMin(10,10-power10);
-	  char format[8];
-	  sprintf(format,"%%12.%df",decimal);
-	  sprintf(outputValue,format,value);
+	  sprintf(outputValue,"%12.*f",decimal,value);
 	} else {
 	  sprintf(outputValue,"%13.7g",value);
 	  stripZeros=false;
@@ -3765,9 +3802,7 @@ CoinConvertDouble(int section, int formatType, double value, char outputValue[24
 	power10 =static_cast<int> (log10(-value))+1;
 	if (power10<8&&power10>-3) {
 	  decimal = CoinMin(9,9-power10);
-	  char format[8];
-	  sprintf(format,"%%12.%df",decimal);
-	  sprintf(outputValue,format,value);
+	  sprintf(outputValue,"%12.*f",decimal,value);
 	} else {
 	  sprintf(outputValue,"%13.6g",value);
 	  stripZeros=false;
@@ -3844,16 +3879,35 @@ CoinConvertDouble(int section, int formatType, double value, char outputValue[24
     outputValue[12]='\0';
   } else if (formatType==1) {
     if (fabs(value)<1.0e40) {
-      memset(outputValue,' ',24);
-      sprintf(outputValue,"%.16g",value);
-      // take out blanks
-      int i=0;
-      int j;
-      for (j=0;j<23;j++) {
-	if (outputValue[j]!=' ')
-	  outputValue[i++]=outputValue[j];
+      // shortest string which reads back as exactly the same value
+      char temp[32];
+      if (value==floor(value)&&fabs(value)<1.0e15) {
+	sprintf(temp,"%.0f",value);
+      } else {
+	sprintf(temp,"%.15g",value);
+	if (strtod(temp,NULL)!=value) {
+	  sprintf(temp,"%.16g",value);
+	  if (strtod(temp,NULL)!=value) 
+	    sprintf(temp,"%.17g",value);
+	}
+      }
+      char * e = strchr(temp,'e');
+      if (e&&strlen(temp)>23) {
+	// e.g. -1.2345678901234567e-300 - lose decimal point to fit
+	int power = atoi(e+1);
+	char * put = temp;
+	int nAfter = -1;
+	for (char * get = temp;get<e;get++) {
+	  if (*get=='.') 
+	    nAfter=0;
+	  else if (nAfter>=0) 
+	    nAfter++;
+	  if (*get!='.')
+	    *put++ = *get;
+	}
+	sprintf(put,"e%d",power-CoinMax(nAfter,0));
       }
-      outputValue[i]='\0';
+      strcpy(outputValue,temp);
     } else {
       if (section==2) {
         outputValue[0]= '\0'; // needs no value
@@ -3922,11 +3976,50 @@ writeString(CoinFileOutput *output, const char* str)
       output->puts (str);
    }
 }
+// Size of block collected before being passed to compression or file
+#define COIN_MPS_OUTPUT_BLOCK 65536
+/* Collects lines in one large block so each card is not a separate
+   write (gzwrite or BZ2_bzWrite have a large cost per call).  Block is
+   written in order when full and when deleted.  Owns real output. */
+class CoinMpsBlockOutput : public CoinFileOutput {
+public:
+  CoinMpsBlockOutput(CoinFileOutput * output)
+    : CoinFileOutput(output->getFileName()),
+      output_(output),
+      numberInBlock_(0)
+  {}
+  virtual ~CoinMpsBlockOutput()
+  {
+    flush();
+    delete output_;
+  }
+  virtual int write (const void * buffer, int size)
+  {
+    if (numberInBlock_+size>COIN_MPS_OUTPUT_BLOCK) {
+      flush();
+      if (size>COIN_MPS_OUTPUT_BLOCK) 
+	return output_->write(buffer,size);
+    }
+    memcpy(block_+numberInBlock_,buffer,size);
+    numberInBlock_ += size;
+    return size;
+  }
+  void flush()
+  {
+    if (numberInBlock_)
+      output_->write(block_,numberInBlock_);
+    numberInBlock_=0;
+  }
+private:
+  CoinFileOutput * output_;
+  int numberInBlock_;
+  char block_[COIN_MPS_OUTPUT_BLOCK];
+};
 
 // Put out card image
 static void outputCard(int formatType,int numberFields,
 		       CoinFileOutput *output,
-		       std::string head, const char * name,
+		       const std::string & head, const char * name,
 		       const char outputValue[2][24],
 		       const char outputRow[2][100])
 {
@@ -4092,6 +4185,7 @@ CoinMpsIO::writeMps(const char *filename, int compression,
      output = CoinFileOutput::create (line, CoinFileOutput::COMPRESS_NONE);
      break;
    }
+   output = new CoinMpsBlockOutput(output);
 
    const char * const * const rowNames = names_[0];
    const char * const * const columnNames = names_[1];
@@ -313,6 +313,21 @@ protected:
   //@}
 };
 
+//#############################################################################
+/** Name to index lookup for CoinMpsIO::readBasis.
+
+    A solver which already keeps an index of its row and column names can
+    pass one of these so readBasis does not hash all names again.
+*/
+class CoinMpsNameIndex {
+
+public:
+  /// Destructor
+  virtual ~CoinMpsNameIndex ( ) {}
+  /// Returns row (which 0) or column (which 1) with given name or -1
+  virtual int index(const char * name, int which) const = 0;
+};
+
 //#############################################################################
 
 /** MPS IO Interface
@@ -625,12 +640,15 @@ public:
 
       Use "stdin" or "-" to read from stdin.
 
-      If sizes of names incorrect - read without names
+      If sizes of names incorrect - read without names.
+      If nameIndex is given names are looked up with it rather than
+      by hashing colnames and rownames.
     */
     int readBasis(const char *filename, const char *extension ,
 		  double * solution, unsigned char *rowStatus, unsigned char *columnStatus,
 		  const std::vector<std::string> & colnames,int numberColumns,
-		  const std::vector<std::string> & rownames, int numberRows);
+		  const std::vector<std::string> & rownames, int numberRows,
+		  const CoinMpsNameIndex * nameIndex = NULL);
 
     /** Read a problem in GAMS format from the given filename.
 
@@ -676,7 +694,8 @@ public:
 	MPS file
 	<ul>
 	  <li> 0: normal precision (default)
-	  <li> 1: extra accuracy
+	  <li> 1: extra accuracy - shortest decimal string which reads back
+	  as exactly the same double
 	  <li> 2: IEEE hex
 	</ul>
 
@@ -1045,7 +1064,7 @@ CoinMpsIOUnitTest(const std::string & mpsDir);
 // section is 0 for columns, 1 for rhs,ranges and 2 for bounds
 /* formatType is
    0 - normal and 8 character names
-   1 - extra accuracy
+   1 - extra accuracy (shortest string which reads back exactly)
    2 - IEEE hex - INTEL
    3 - IEEE hex - not INTEL
 */
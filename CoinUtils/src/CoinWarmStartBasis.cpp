@@ -14,6 +14,7 @@
 #include "CoinWarmStartBasis.hpp"
 #include "CoinHelperFunctions.hpp"
 #include <cmath>
+#include <cstdio>
 #include <iostream>
 
 //#############################################################################
@@ -417,6 +418,143 @@ CoinWarmStartBasis::print() const
     std::cout<<type[getStructStatus(i)];
   std::cout<<std::endl;
 }
+/*
+  Binary basis file - all integers little endian:
+    8 bytes  magic "CoinWSB1"
+    4 bytes  number of structurals
+    4 bytes  number of artificials
+    4 bytes  FNV-1a checksum of the two status arrays
+  then (ns+3)/4 bytes structural status and (na+3)/4 bytes artificial
+  status, packed exactly as in memory with unused bits zero.
+*/
+static const char binaryBasisMagic[9] = "CoinWSB1";
+
+static void
+putInt (unsigned char * buffer, unsigned int value)
+{
+  buffer[0] = static_cast<unsigned char>(value);
+  buffer[1] = static_cast<unsigned char>(value>>8);
+  buffer[2] = static_cast<unsigned char>(value>>16);
+  buffer[3] = static_cast<unsigned char>(value>>24);
+}
+
+static unsigned int
+getInt (const unsigned char * buffer)
+{
+  return buffer[0] | (buffer[1]<<8) | (buffer[2]<<16) |
+    (static_cast<unsigned int>(buffer[3])<<24);
+}
+
+static unsigned int
+binaryChecksum (unsigned int hash, const char * array, int n)
+{
+  for (int i=0;i<n;i++) {
+    hash ^= static_cast<unsigned char>(array[i]);
+    hash *= 16777619u;
+  }
+  return hash;
+}
+
+// Number of bytes of status for n variables
+inline static int statusBytes (int n)
+{
+  // not (n+3)>>2 which overflows for n near largest int
+  return (n>>2)+((n&3) ? 1 : 0);
+}
+
+int
+CoinWarmStartBasis::writeBinary(const char *fileName) const
+{
+  FILE * fp = fopen(fileName,"wb");
+  if (!fp)
+    return -1;
+  int nS = statusBytes(numStructural_);
+  int nA = statusBytes(numArtificial_);
+  // mask out unused bits of last byte
+  char lastS = 0;
+  char lastA = 0;
+  if (nS) {
+    lastS = structuralStatus_[nS-1];
+    if (numStructural_&3)
+      lastS = static_cast<char>(lastS & ((1<<((numStructural_&3)<<1))-1));
+  }
+  if (nA) {
+    lastA = artificialStatus_[nA-1];
+    if (numArtificial_&3)
+      lastA = static_cast<char>(lastA & ((1<<((numArtificial_&3)<<1))-1));
+  }
+  unsigned int hash = 2166136261u;
+  hash = binaryChecksum(hash,structuralStatus_,nS-1);
+  hash = binaryChecksum(hash,&lastS,nS ? 1 : 0);
+  hash = binaryChecksum(hash,artificialStatus_,nA-1);
+  hash = binaryChecksum(hash,&lastA,nA ? 1 : 0);
+  unsigned char header[20];
+  memcpy(header,binaryBasisMagic,8);
+  putInt(header+8,numStructural_);
+  putInt(header+12,numArtificial_);
+  putInt(header+16,hash);
+  bool ok = fwrite(header,1,20,fp)==20;
+  if (nS) {
+    ok = ok && static_cast<int>(fwrite(structuralStatus_,1,nS-1,fp))==nS-1;
+    ok = ok && fwrite(&lastS,1,1,fp)==1;
+  }
+  if (nA) {
+    ok = ok && static_cast<int>(fwrite(artificialStatus_,1,nA-1,fp))==nA-1;
+    ok = ok && fwrite(&lastA,1,1,fp)==1;
+  }
+  if (fclose(fp))
+    ok = false;
+  return ok ? 0 : -2;
+}
+
+int
+CoinWarmStartBasis::readBinary(const char *fileName)
+{
+  FILE * fp = fopen(fileName,"rb");
+  if (!fp)
+    return -1;
+  unsigned char header[20];
+  if (fread(header,1,20,fp)!=20||memcmp(header,binaryBasisMagic,8)) {
+    fclose(fp);
+    return -2;
+  }
+  int ns = static_cast<int>(getInt(header+8));
+  int na = static_cast<int>(getInt(header+12));
+  unsigned int hash = getInt(header+16);
+  // sizes must agree with rest of file before anything is allocated
+  long position = ftell(fp);
+  long length = -1;
+  if (position>=0&&!fseek(fp,0,SEEK_END)) {
+    length = ftell(fp);
+    if (fseek(fp,position,SEEK_SET))
+      length = -1;
+  }
+  if (ns<0||na<0||length<0) {
+    fclose(fp);
+    return -3;
+  }
+  int nS = statusBytes(ns);
+  int nA = statusBytes(na);
+  if (static_cast<long>(nS)+nA>length-position) {
+    fclose(fp);
+    return -3;
+  }
+  setSize(ns,na);
+  bool ok = static_cast<int>(fread(structuralStatus_,1,nS,fp))==nS &&
+    static_cast<int>(fread(artificialStatus_,1,nA,fp))==nA;
+  fclose(fp);
+  unsigned int check = 2166136261u;
+  if (ok) {
+    check = binaryChecksum(check,structuralStatus_,nS);
+    check = binaryChecksum(check,artificialStatus_,nA);
+  }
+  if (!ok||check!=hash) {
+    setSize(0,0);
+    return -3;
+  }
+  return 0;
+}
+
 CoinWarmStartBasis::CoinWarmStartBasis()
 {
   
@@ -321,6 +321,23 @@ public:
   /// Returns true if full basis and fixes up (for debug)
   bool fixFullBasis();
 
+  /*! \brief Write basis to a file in compact binary form
+
+    The file holds a short header (magic, dimensions and a checksum)
+    followed by the packed status arrays, so it is about a quarter of a
+    byte per variable and needs no names.
+    Returns 0 if OK, -1 if file could not be opened, -2 on write error.
+  */
+  int writeBinary(const char *fileName) const;
+  /*! \brief Read basis written by writeBinary
+
+    Returns 0 if OK, -1 if file could not be opened, -2 if the file is
+    not a binary basis file (nothing is changed) and -3 if it is
+    truncated or the checksum is wrong.  Sizes in the header are checked
+    against the length of the file before anything is allocated.
+  */
+  int readBinary(const char *fileName);
+
 //@}
 
 protected:
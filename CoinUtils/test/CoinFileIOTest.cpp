@@ -0,0 +1,108 @@
+// Copyright (C) 2005, COIN-OR.  All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif
+
+#include <cassert>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "CoinFileIO.hpp"
+
+//#############################################################################
+
+// Reads whole file a line at a time
+static void readLines(const std::string & fileName,
+                      std::vector<std::string> & lines)
+{
+  CoinFileInput * input = CoinFileInput::create(fileName);
+  char line[1000];
+  while (input->gets(line, sizeof(line)))
+    lines.push_back(line);
+  delete input;
+}
+
+// Reads whole file in odd sized pieces
+static std::string readAll(const std::string & fileName)
+{
+  CoinFileInput * input = CoinFileInput::create(fileName);
+  std::string all;
+  char buffer[7919];
+  int count;
+  while ((count = input->read(buffer, sizeof(buffer))) > 0)
+    all.append(buffer, count);
+  delete input;
+  return all;
+}
+
+/* Compressed input is decompressed ahead of use (on a separate thread if
+   COINUTILS_PTHREADS is defined) so write a file much bigger than the
+   read-ahead buffers and check it reads back the same as plain text.
+   Also delete readers part way through while read-ahead is blocked. */
+void
+CoinFileIOUnitTest()
+{
+  const char * plainName = "CoinFileIOTest.txt";
+  const char * gzipName = "CoinFileIOTest.txt.gz";
+  const char * bzip2Name = "CoinFileIOTest.txt.bz2";
+  int numberLines = 100000;
+  {
+    CoinFileOutput * output =
+      CoinFileOutput::create(plainName, CoinFileOutput::COMPRESS_NONE);
+    char line[100];
+    for (int i = 0; i < numberLines; i++) {
+      sprintf(line, "line %d of test file with some padding %d\n",
+	      i, (i * 7919) % 10007);
+      assert (output->puts(line));
+    }
+    delete output;
+  }
+  std::string plain = readAll(plainName);
+  std::vector<std::string> plainLines;
+  readLines(plainName, plainLines);
+  assert (static_cast<int>(plainLines.size()) == numberLines);
+
+  for (int iType = 0; iType < 2; iType++) {
+    CoinFileOutput::Compression compression =
+      iType ? CoinFileOutput::COMPRESS_BZIP2 : CoinFileOutput::COMPRESS_GZIP;
+    if (!CoinFileOutput::compressionSupported(compression))
+      continue;
+    if (iType ? !CoinFileInput::haveBzip2Support() :
+	!CoinFileInput::haveGzipSupport())
+      continue;
+    const char * fileName = iType ? bzip2Name : gzipName;
+    {
+      CoinFileOutput * output = CoinFileOutput::create(fileName, compression);
+      assert (output->write(plain.c_str(), static_cast<int>(plain.size())) ==
+	      static_cast<int>(plain.size()));
+      delete output;
+    }
+    // same lines as plain file
+    std::vector<std::string> lines;
+    readLines(fileName, lines);
+    assert (lines == plainLines);
+    // same bytes as plain file
+    assert (readAll(fileName) == plain);
+    // delete before reading anything
+    {
+      CoinFileInput * input = CoinFileInput::create(fileName);
+      delete input;
+    }
+    // delete part way through - read-ahead will be waiting for space
+    for (int iStop = 1; iStop < 100000; iStop *= 10) {
+      CoinFileInput * input = CoinFileInput::create(fileName);
+      char line[1000];
+      for (int i = 0; i < iStop; i++) {
+	assert (input->gets(line, sizeof(line)));
+	assert (plainLines[i] == line);
+      }
+      delete input;
+    }
+    remove(fileName);
+  }
+  remove(plainName);
+}
@@ -362,4 +362,29 @@ CoinLpIOUnitTest(const std::string& lpDir)
          }
       }
    }
+   // Test reading from a stream with comments and data after End
+   {
+      CoinRelFltEq eq;
+      FILE * fp = tmpfile();
+      if (fp) {
+         fprintf(fp, "\\ comment at start\nMinimize\nobj: x + 2 y \\ end of line\n");
+         fprintf(fp, "Subject To\nc1: x + y >= 1.5\n\\ whole line\nc2: x - y <= 3\n");
+         fprintf(fp, "Bounds\ny <= 4\nEnd\nnext\n");
+         rewind(fp);
+         CoinLpIO m;
+         m.readLp(fp);
+         assert( m.getNumRows() == 2 );
+         assert( m.getNumCols() == 2 );
+         assert( m.getNumElements() == 4 );
+         assert( eq(m.getObjCoefficients()[1], 2.0) );
+         assert( eq(m.getRowLower()[0], 1.5) );
+         assert( eq(m.getRowUpper()[1], 3.0) );
+         assert( eq(m.getColUpper()[1], 4.0) );
+         // rest of file still there
+         char next[20];
+         int n = fscanf(fp, "%19s", next);
+         assert( n == 1 && !strcmp(next, "next") );
+         fclose(fp);
+      }
+   }
 }
@@ -158,6 +158,38 @@ CoinMpsIOUnitTest(const std::string & mpsDir)
       assert( eq( dumSi.getObjCoefficients()[6],  0.0) );
       assert( eq( dumSi.getObjCoefficients()[7], -1.0) );
     }
+
+    // Test extra accuracy format reads back exactly
+    {
+      double values[4] = {1.0/3.0, 0.1+0.2, -2.0e-5/3.0, 123456789.123456789};
+      int rows[4] = {0, 0, 1, 1};
+      int columns[4] = {0, 1, 0, 1};
+      CoinPackedMatrix matrix(true, rows, columns, values, 4);
+      double columnLower[2] = {values[0], -values[1]};
+      double columnUpper[2] = {1.0e10/3.0, -1.2345678901234567e-300};
+      double objective[2] = {values[3], values[2]};
+      double rowLower[2] = {-COIN_DBL_MAX, 0.7};
+      double rowUpper[2] = {1.0/7.0, COIN_DBL_MAX};
+      CoinMpsIO m;
+      m.setMpsData(matrix, COIN_DBL_MAX, columnLower, columnUpper, objective,
+		   NULL, rowLower, rowUpper, 
+		   static_cast<char **>(NULL), static_cast<char **>(NULL));
+      m.writeMps("CoinMpsIoTestExact.mps", 0, 1);
+      CoinMpsIO m2;
+      m2.messageHandler()->setLogLevel(0);
+      m2.readMps("CoinMpsIoTestExact.mps", "");
+      assert( m2.getNumElements() == 4 );
+      const double * elements = m2.getMatrixByCol()->getElements();
+      assert( elements[0] == values[0] && elements[1] == values[2] );
+      assert( elements[2] == values[1] && elements[3] == values[3] );
+      for (int i = 0; i < 2; i++) {
+	assert( m2.getColLower()[i] == columnLower[i] );
+	assert( m2.getColUpper()[i] == columnUpper[i] );
+	assert( m2.getObjCoefficients()[i] == objective[i] );
+      }
+      assert( m2.getRowUpper()[0] == rowUpper[0] );
+      assert( m2.getRowLower()[1] == rowLower[1] );
+    }
     
     // Test matrixByRow method
     { 
@@ -26,6 +26,7 @@
 #include "CoinMessageHandler.hpp"
 void CoinModelUnitTest(const std::string & mpsDir,
                        const std::string & netlibDir, const std::string & testModel);
+void CoinFileIOUnitTest();
 // Function Prototypes. Function definitions is in this file.
 void testingMessage( const char * const msg );
 
@@ -204,6 +205,9 @@ int main (int argc, const char *argv[])
   testingMessage( "Testing CoinLpIO\n" );
   CoinLpIOUnitTest(mpsDir);
 
+  testingMessage( "Testing CoinFileIO\n" );
+  CoinFileIOUnitTest();
+
   testingMessage( "Testing CoinMessageHandler\n" );
   if (!CoinMessageHandlerUnitTest())
   { allOK = false ; }